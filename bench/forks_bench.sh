@@ -0,0 +1,34 @@
+#!/bin/bash
+# Compare philo_bonus fork acquisition modes.
+# usage: bench/forks_bench.sh [seconds] [runs]
+
+BIN="$(dirname "$0")/../philo_bonus/philo_bonus"
+SECS=${1:-5}
+RUNS=${2:-5}
+CASES=("5 800 200 200" "5 610 200 200" "4 410 200 200" "3 700 200 100" \
+	"200 800 200 200" "199 1000 200 200")
+
+run_case() {
+	local mode=$1 args=$2 deaths=0 meals=0 hold=0 out
+	for _ in $(seq "$RUNS"); do
+		out=$(timeout "$SECS" stdbuf -oL "$BIN" --forks="$mode" $args)
+		pkill -9 -x philo_bonus 2>/dev/null
+		echo "$out" | grep -q died && deaths=$((deaths + 1))
+		meals=$((meals + $(echo "$out" | grep -c "is eating")))
+		hold=$((hold + $(echo "$out" | awk '
+			/has taken a fork/ { if (!($2 in t)) t[$2] = $1 }
+			/is eating/ { if ($2 in t) { s += $1 - t[$2]; n++; delete t[$2] } }
+			END { if (n) printf "%d", s * 1000 / n; else print 0 }')))
+	done
+	awk -v m="$mode" -v a="$args" -v d="$deaths" -v r="$RUNS" -v s="$SECS" \
+		-v e="$meals" -v h="$hold" 'BEGIN {
+		printf "%-6s %-18s deaths=%d/%d meals/s=%-8.1f idle_hold_ms=%.3f\n",
+			m, a, d, r, e / r / s, h / r / 1000 }'
+}
+
+[ -x "$BIN" ] || make -C "$(dirname "$0")/../philo_bonus" >/dev/null
+for args in "${CASES[@]}"; do
+	for mode in pool seats; do
+		run_case "$mode" "$args"
+	done
+done
@@ -0,0 +1,125 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   philo_micro.h                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 20:12:54 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 20:12:54 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PHILO_MICRO_H
+# define PHILO_MICRO_H
+
+# include <math.h>
+# include <sched.h>
+# include <semaphore.h>
+# include <stdatomic.h>
+# include <sys/wait.h>
+# include "philo.h"
+
+# define MAX_ROUNDS 101
+# define DEFAULT_ROUNDS 15
+# define MAX_SPINNERS 8
+# define SINK_TTY 0
+# define SINK_PIPE 1
+# define SINK_FILE 2
+
+typedef struct s_micro
+{
+	int				rounds;
+	int				json;
+	char			*only;
+	int				ncpu;
+	int				cpu_a;
+	int				cpu_b;
+}					t_micro;
+
+typedef double		(*t_sample)(t_micro *m, void *ctx);
+
+typedef struct s_case
+{
+	char			name[48];
+	char			*unit;
+	t_sample		fn;
+	void			*ctx;
+}					t_case;
+
+typedef struct s_stat
+{
+	double			median;
+	double			mean;
+	double			sd;
+	double			min;
+	double			max;
+}					t_stat;
+
+typedef struct s_nap
+{
+	t_rules			rules;
+	long			ms;
+}					t_nap;
+
+typedef struct s_sink
+{
+	int				kind;
+	int				fd;
+	int				reader;
+	int				draining;
+	pthread_t		drain;
+}					t_sink;
+
+typedef struct s_out
+{
+	t_rules			rules;
+	t_philo			philo;
+	t_sink			sink;
+	int				saved;
+}					t_out;
+
+typedef struct s_spin
+{
+	t_rules			rules;
+	t_philo			philo;
+	t_micro			*m;
+	atomic_int		run;
+	atomic_int		next;
+	int				count;
+	pthread_t		th[MAX_SPINNERS];
+}					t_spin;
+
+typedef struct s_handoff
+{
+	pthread_mutex_t	fork;
+	t_micro			*m;
+	atomic_int		phase;
+	atomic_long		t0;
+	long			total;
+}					t_handoff;
+
+typedef struct s_pingpong
+{
+	sem_t			ping;
+	sem_t			pong;
+	atomic_int		stop;
+}					t_pingpong;
+
+long				now_ns(void);
+void				collect(t_micro *m, t_case *c);
+void				print_header(t_micro *m);
+int					pin_cpu(int cpu);
+int					selected(t_micro *m, char *group);
+int					fake_rules(t_rules *rules, t_philo *philo);
+void				drop_rules(t_rules *rules);
+int					open_sink(t_sink *sink, int kind);
+void				close_sink(t_sink *sink);
+void				bench_clock(t_micro *m);
+void				bench_usleep(t_micro *m);
+void				bench_print(t_micro *m);
+void				bench_stop(t_micro *m);
+void				bench_handoff(t_micro *m);
+void				bench_sem(t_micro *m);
+
+#endif
@@ -0,0 +1,90 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   clock_bench.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 20:12:54 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 20:12:54 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_micro.h"
+
+#define CLOCK_CALLS 1000000
+
+static double	clock_round(t_micro *m, void *ctx)
+{
+	volatile long	sink;
+	long			start;
+	long			idx;
+
+	(void)m;
+	sink = 0;
+	start = now_ns();
+	idx = 0;
+	while (idx < CLOCK_CALLS)
+	{
+		if (*(int *)ctx == 0)
+			sink += get_time_ms();
+		else
+			sink += get_time_us();
+		idx++;
+	}
+	return ((double)(now_ns() - start) / CLOCK_CALLS);
+}
+
+void	bench_clock(t_micro *m)
+{
+	t_case	c;
+	int		which;
+
+	if (!selected(m, "clock"))
+		return ;
+	c.unit = "ns/call";
+	c.fn = clock_round;
+	c.ctx = &which;
+	which = 0;
+	snprintf(c.name, sizeof(c.name), "get_time_ms");
+	collect(m, &c);
+	which = 1;
+	snprintf(c.name, sizeof(c.name), "get_time_us");
+	collect(m, &c);
+}
+
+static double	nap_round(t_micro *m, void *ctx)
+{
+	t_nap	*nap;
+	long	start;
+
+	(void)m;
+	nap = ctx;
+	start = now_ns();
+	ft_usleep(&nap->rules, nap->ms);
+	return ((double)(now_ns() - start) / 1000.0 - nap->ms * 1000);
+}
+
+void	bench_usleep(t_micro *m)
+{
+	static long	durations[] = {1, 2, 5, 10, 20, 50, 100, 200, 500, 0};
+	t_philo		philo;
+	t_nap		nap;
+	t_case		c;
+	int			idx;
+
+	if (!selected(m, "usleep") || !fake_rules(&nap.rules, &philo))
+		return ;
+	c.unit = "us over";
+	c.fn = nap_round;
+	c.ctx = &nap;
+	idx = 0;
+	while (durations[idx])
+	{
+		nap.ms = durations[idx];
+		snprintf(c.name, sizeof(c.name), "ft_usleep %ld ms", nap.ms);
+		collect(m, &c);
+		idx++;
+	}
+	drop_rules(&nap.rules);
+}
@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   handoff.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 20:12:54 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 20:12:54 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_micro.h"
+
+#define HANDOFFS 1000
+#define SETTLE_US 50
+
+static void	wait_phase(t_handoff *h, int phase)
+{
+	while (atomic_load(&h->phase) != phase)
+		sched_yield();
+}
+
+static void	*holder(void *arg)
+{
+	t_handoff	*h;
+	int			idx;
+
+	h = arg;
+	pin_cpu(h->m->cpu_a);
+	idx = 0;
+	while (idx < HANDOFFS)
+	{
+		pthread_mutex_lock(&h->fork);
+		atomic_store(&h->phase, 1);
+		wait_phase(h, 2);
+		usleep(SETTLE_US);
+		atomic_store(&h->t0, now_ns());
+		pthread_mutex_unlock(&h->fork);
+		wait_phase(h, 3);
+		idx++;
+	}
+	return (NULL);
+}
+
+static void	*taker(void *arg)
+{
+	t_handoff	*h;
+	int			idx;
+
+	h = arg;
+	pin_cpu(h->m->cpu_b);
+	idx = 0;
+	while (idx < HANDOFFS)
+	{
+		wait_phase(h, 1);
+		atomic_store(&h->phase, 2);
+		pthread_mutex_lock(&h->fork);
+		h->total += now_ns() - atomic_load(&h->t0);
+		pthread_mutex_unlock(&h->fork);
+		atomic_store(&h->phase, 3);
+		idx++;
+	}
+	return (NULL);
+}
+
+static double	handoff_round(t_micro *m, void *ctx)
+{
+	t_handoff	*h;
+	pthread_t	a;
+	pthread_t	b;
+
+	h = ctx;
+	h->m = m;
+	h->total = 0;
+	atomic_store(&h->phase, 0);
+	if (pthread_create(&a, NULL, holder, h) != 0
+		|| pthread_create(&b, NULL, taker, h) != 0)
+	{
+		fprintf(stderr, "philo_micro: cannot create threads\n");
+		exit(1);
+	}
+	pthread_join(a, NULL);
+	pthread_join(b, NULL);
+	return ((double)h->total / HANDOFFS);
+}
+
+void	bench_handoff(t_micro *m)
+{
+	t_handoff	h;
+	t_case		c;
+
+	if (!selected(m, "handoff"))
+		return ;
+	if (pthread_mutex_init(&h.fork, NULL) != 0)
+		return ;
+	c.unit = "ns";
+	c.fn = handoff_round;
+	c.ctx = &h;
+	snprintf(c.name, sizeof(c.name), "fork handoff cpu%d->cpu%d",
+		m->cpu_a, m->cpu_b);
+	collect(m, &c);
+	pthread_mutex_destroy(&h.fork);
+}
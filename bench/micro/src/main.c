@@ -0,0 +1,96 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   main.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 20:12:54 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 20:12:54 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_micro.h"
+
+static int	usage(void)
+{
+	fprintf(stderr, "Usage: ./philo_micro [OPTIONS]\n\n"
+		"  --rounds=N        measured rounds per benchmark, 3-%d (%d)\n"
+		"  --only=LIST       run only these groups: clock,usleep,print,"
+		"stop,handoff,sem\n"
+		"  --cpus=A,B        CPUs for the two sides of the cross-thread"
+		" and\n"
+		"                    cross-process benchmarks (0,1)\n"
+		"  --json            one JSON object per result\n",
+		MAX_ROUNDS, DEFAULT_ROUNDS);
+	return (2);
+}
+
+static int	parse_cpus(t_micro *m, char *arg)
+{
+	char	*end;
+
+	m->cpu_a = strtol(arg, &end, 10);
+	if (end == arg || *end != ',')
+		return (0);
+	arg = end + 1;
+	m->cpu_b = strtol(arg, &end, 10);
+	return (end != arg && *end == '\0' && m->cpu_a >= 0 && m->cpu_b >= 0
+		&& m->cpu_a < m->ncpu && m->cpu_b < m->ncpu);
+}
+
+static int	parse_args(t_micro *m, int ac, char **av)
+{
+	int	idx;
+
+	memset(m, 0, sizeof(t_micro));
+	m->rounds = DEFAULT_ROUNDS;
+	m->ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+	m->cpu_b = (m->ncpu > 1);
+	idx = 0;
+	while (++idx < ac)
+	{
+		if (strncmp(av[idx], "--rounds=", 9) == 0)
+			m->rounds = atoi(av[idx] + 9);
+		else if (strncmp(av[idx], "--only=", 7) == 0)
+			m->only = av[idx] + 7;
+		else if (strncmp(av[idx], "--cpus=", 7) == 0)
+		{
+			if (!parse_cpus(m, av[idx] + 7))
+				return (0);
+		}
+		else if (strcmp(av[idx], "--json") == 0)
+			m->json = 1;
+		else
+			return (0);
+	}
+	return (m->rounds >= 3 && m->rounds <= MAX_ROUNDS);
+}
+
+void	print_header(t_micro *m)
+{
+	if (m->json)
+		return ;
+	printf("philo_micro: %d rounds after 1 warm-up, %d cpus, "
+		"main thread on cpu%d\n\n", m->rounds, m->ncpu, m->cpu_a);
+	printf("%-28s %10s %10s %9s %10s %10s  %s\n", "benchmark", "median",
+		"mean", "sd", "min", "max", "unit");
+}
+
+int	main(int ac, char **av)
+{
+	t_micro	m;
+
+	if (!parse_args(&m, ac, av))
+		return (usage());
+	if (!pin_cpu(m.cpu_a))
+		fprintf(stderr, "philo_micro: cannot pin to cpu%d\n", m.cpu_a);
+	print_header(&m);
+	bench_clock(&m);
+	bench_usleep(&m);
+	bench_print(&m);
+	bench_stop(&m);
+	bench_handoff(&m);
+	bench_sem(&m);
+	return (0);
+}
@@ -0,0 +1,88 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   print_bench.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 20:12:55 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 20:32:46 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_micro.h"
+
+#define PRINT_CALLS 20000
+
+static void	print_line(void *ctx, t_philo_event *ev)
+{
+	(void)ctx;
+	printf("%ld %d %s\n", ev->ts, ev->id, "is thinking");
+}
+
+static void	point_stdout(int fd)
+{
+	fflush(stdout);
+	dup2(fd, STDOUT_FILENO);
+	if (isatty(fd))
+		setvbuf(stdout, NULL, _IOLBF, BUFSIZ);
+	else
+		setvbuf(stdout, NULL, _IOFBF, BUFSIZ);
+}
+
+static double	print_round(t_micro *m, void *ctx)
+{
+	t_out	*out;
+	long	start;
+	long	idx;
+
+	(void)m;
+	out = ctx;
+	point_stdout(out->sink.fd);
+	start = now_ns();
+	idx = 0;
+	while (idx < PRINT_CALLS)
+	{
+		print_state(&out->philo, ST_THINKING, 0);
+		idx++;
+	}
+	fflush(stdout);
+	start = now_ns() - start;
+	point_stdout(out->saved);
+	return ((double)start / PRINT_CALLS);
+}
+
+static void	print_to(t_micro *m, t_out *out, int kind, char *label)
+{
+	t_case	c;
+
+	if (!open_sink(&out->sink, kind))
+	{
+		fprintf(stderr, "philo_micro: cannot open %s sink\n", label);
+		return ;
+	}
+	c.unit = "ns/call";
+	c.fn = print_round;
+	c.ctx = out;
+	snprintf(c.name, sizeof(c.name), "print_state to %s", label);
+	collect(m, &c);
+	close_sink(&out->sink);
+}
+
+void	bench_print(t_micro *m)
+{
+	t_out	out;
+
+	if (!selected(m, "print") || !fake_rules(&out.rules, &out.philo))
+		return ;
+	out.rules.on_event = print_line;
+	out.saved = dup(STDOUT_FILENO);
+	if (out.saved >= 0)
+	{
+		print_to(m, &out, SINK_TTY, "tty");
+		print_to(m, &out, SINK_PIPE, "pipe");
+		print_to(m, &out, SINK_FILE, "file");
+		close(out.saved);
+	}
+	drop_rules(&out.rules);
+}
@@ -0,0 +1,114 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sem_bench.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 20:12:55 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 20:12:55 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_micro.h"
+
+#define SEM_TRIPS 20000
+
+static void	pong(t_micro *m, t_pingpong *pp)
+{
+	pin_cpu(m->cpu_b);
+	while (1)
+	{
+		sem_wait(&pp->ping);
+		if (atomic_load(&pp->stop))
+			exit(0);
+		sem_post(&pp->pong);
+	}
+}
+
+static double	trip_round(t_micro *m, void *ctx)
+{
+	t_pingpong	*pp;
+	long		start;
+	long		idx;
+
+	(void)m;
+	pp = ctx;
+	start = now_ns();
+	idx = 0;
+	while (idx < SEM_TRIPS)
+	{
+		sem_post(&pp->ping);
+		sem_wait(&pp->pong);
+		idx++;
+	}
+	return ((double)(now_ns() - start) / SEM_TRIPS);
+}
+
+static double	local_round(t_micro *m, void *ctx)
+{
+	t_pingpong	*pp;
+	long		start;
+	long		idx;
+
+	(void)m;
+	pp = ctx;
+	start = now_ns();
+	idx = 0;
+	while (idx < SEM_TRIPS)
+	{
+		sem_post(&pp->pong);
+		sem_wait(&pp->pong);
+		idx++;
+	}
+	return ((double)(now_ns() - start) / SEM_TRIPS);
+}
+
+static void	run_trips(t_micro *m, t_pingpong *pp)
+{
+	t_case	c;
+	pid_t	pid;
+
+	c.unit = "ns/op";
+	c.fn = local_round;
+	c.ctx = pp;
+	snprintf(c.name, sizeof(c.name), "sem_post+sem_wait local");
+	collect(m, &c);
+	fflush(stdout);
+	pid = fork();
+	if (pid < 0)
+		return ;
+	if (pid == 0)
+		pong(m, pp);
+	c.unit = "ns/trip";
+	c.fn = trip_round;
+	snprintf(c.name, sizeof(c.name), "sem round trip cpu%d<->cpu%d",
+		m->cpu_a, m->cpu_b);
+	collect(m, &c);
+	atomic_store(&pp->stop, 1);
+	sem_post(&pp->ping);
+	waitpid(pid, NULL, 0);
+}
+
+void	bench_sem(t_micro *m)
+{
+	t_pingpong	*pp;
+
+	if (!selected(m, "sem"))
+		return ;
+	pp = mmap(NULL, sizeof(t_pingpong), PROT_READ | PROT_WRITE,
+			MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (pp == MAP_FAILED)
+		return ;
+	atomic_store(&pp->stop, 0);
+	if (sem_init(&pp->ping, 1, 0) == 0)
+	{
+		if (sem_init(&pp->pong, 1, 0) == 0)
+		{
+			run_trips(m, pp);
+			sem_destroy(&pp->pong);
+		}
+		sem_destroy(&pp->ping);
+	}
+	munmap(pp, sizeof(t_pingpong));
+}
@@ -0,0 +1,88 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sink.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 20:12:55 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 20:12:55 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_micro.h"
+
+static void	*drain_sink(void *arg)
+{
+	t_sink	*sink;
+	char	buf[65536];
+	ssize_t	got;
+
+	sink = arg;
+	got = 1;
+	while (got > 0)
+		got = read(sink->reader, buf, sizeof(buf));
+	return (NULL);
+}
+
+static int	open_tty(t_sink *sink)
+{
+	sink->reader = posix_openpt(O_RDWR | O_NOCTTY);
+	if (sink->reader < 0)
+		return (0);
+	if (grantpt(sink->reader) != 0 || unlockpt(sink->reader) != 0)
+	{
+		close(sink->reader);
+		return (0);
+	}
+	sink->fd = open(ptsname(sink->reader), O_WRONLY | O_NOCTTY);
+	if (sink->fd < 0)
+		close(sink->reader);
+	return (sink->fd >= 0);
+}
+
+static int	open_file(t_sink *sink)
+{
+	char	path[32];
+
+	memcpy(path, "/tmp/philo_micro.XXXXXX", 24);
+	sink->fd = mkstemp(path);
+	if (sink->fd < 0)
+		return (0);
+	unlink(path);
+	return (1);
+}
+
+int	open_sink(t_sink *sink, int kind)
+{
+	int	fds[2];
+
+	memset(sink, 0, sizeof(t_sink));
+	sink->kind = kind;
+	sink->reader = -1;
+	if (kind == SINK_FILE)
+		return (open_file(sink));
+	if (kind == SINK_TTY && !open_tty(sink))
+		return (0);
+	if (kind == SINK_PIPE)
+	{
+		if (pipe(fds) != 0)
+			return (0);
+		sink->reader = fds[0];
+		sink->fd = fds[1];
+	}
+	sink->draining = (pthread_create(&sink->drain, NULL, drain_sink,
+				sink) == 0);
+	if (!sink->draining)
+		close_sink(sink);
+	return (sink->draining);
+}
+
+void	close_sink(t_sink *sink)
+{
+	close(sink->fd);
+	if (sink->draining)
+		pthread_join(sink->drain, NULL);
+	if (sink->reader >= 0)
+		close(sink->reader);
+}
@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stats.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 20:12:55 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 20:12:55 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_micro.h"
+
+long	now_ns(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000000000L + ts.tv_nsec);
+}
+
+static void	sort_samples(double *samples, int count)
+{
+	double	key;
+	int		idx;
+	int		pos;
+
+	idx = 1;
+	while (idx < count)
+	{
+		key = samples[idx];
+		pos = idx - 1;
+		while (pos >= 0 && samples[pos] > key)
+		{
+			samples[pos + 1] = samples[pos];
+			pos--;
+		}
+		samples[pos + 1] = key;
+		idx++;
+	}
+}
+
+static void	summarize(double *samples, int count, t_stat *st)
+{
+	double	var;
+	int		idx;
+
+	sort_samples(samples, count);
+	st->median = samples[count / 2];
+	st->min = samples[0];
+	st->max = samples[count - 1];
+	st->mean = 0;
+	idx = 0;
+	while (idx < count)
+		st->mean += samples[idx++];
+	st->mean /= count;
+	var = 0;
+	idx = 0;
+	while (idx < count)
+	{
+		var += (samples[idx] - st->mean) * (samples[idx] - st->mean);
+		idx++;
+	}
+	st->sd = sqrt(var / (count - 1));
+}
+
+static void	print_stat(t_micro *m, t_case *c, t_stat *st)
+{
+	if (m->json)
+	{
+		printf("{\"name\": \"%s\", \"unit\": \"%s\", \"rounds\": %d, "
+			"\"median\": %.3f, \"mean\": %.3f, \"sd\": %.3f, "
+			"\"min\": %.3f, \"max\": %.3f}\n", c->name, c->unit, m->rounds,
+			st->median, st->mean, st->sd, st->min, st->max);
+		return ;
+	}
+	printf("%-28s %10.2f %10.2f %9.2f %10.2f %10.2f  %s\n", c->name,
+		st->median, st->mean, st->sd, st->min, st->max, c->unit);
+	fflush(stdout);
+}
+
+void	collect(t_micro *m, t_case *c)
+{
+	double	samples[MAX_ROUNDS];
+	t_stat	st;
+	int		round;
+
+	c->fn(m, c->ctx);
+	round = 0;
+	while (round < m->rounds)
+	{
+		samples[round] = c->fn(m, c->ctx);
+		round++;
+	}
+	summarize(samples, m->rounds, &st);
+	print_stat(m, c, &st);
+}
@@ -0,0 +1,97 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stop_bench.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 20:12:55 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 20:12:55 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_micro.h"
+
+#define STOP_CALLS 1000000
+
+static double	stop_round(t_micro *m, void *ctx)
+{
+	t_spin			*spin;
+	volatile int	sink;
+	long			start;
+	long			idx;
+
+	(void)m;
+	spin = ctx;
+	sink = 0;
+	start = now_ns();
+	idx = 0;
+	while (idx < STOP_CALLS)
+	{
+		sink += get_stop(&spin->rules);
+		idx++;
+	}
+	return ((double)(now_ns() - start) / STOP_CALLS);
+}
+
+static void	*spinner(void *arg)
+{
+	t_spin			*spin;
+	volatile int	sink;
+	int				slot;
+
+	spin = arg;
+	slot = atomic_fetch_add(&spin->next, 1) + 1;
+	pin_cpu((spin->m->cpu_a + slot) % spin->m->ncpu);
+	sink = 0;
+	while (atomic_load(&spin->run))
+		sink += get_stop(&spin->rules);
+	return (NULL);
+}
+
+static void	start_spinners(t_micro *m, t_spin *spin)
+{
+	int	wanted;
+
+	wanted = m->ncpu - 1;
+	if (wanted < 1)
+		wanted = 1;
+	if (wanted > MAX_SPINNERS)
+		wanted = MAX_SPINNERS;
+	atomic_store(&spin->run, 1);
+	atomic_store(&spin->next, 0);
+	spin->count = 0;
+	while (spin->count < wanted
+		&& pthread_create(&spin->th[spin->count], NULL, spinner, spin) == 0)
+		spin->count++;
+}
+
+static void	stop_spinners(t_spin *spin)
+{
+	atomic_store(&spin->run, 0);
+	while (spin->count > 0)
+	{
+		spin->count--;
+		pthread_join(spin->th[spin->count], NULL);
+	}
+}
+
+void	bench_stop(t_micro *m)
+{
+	t_spin	spin;
+	t_case	c;
+
+	if (!selected(m, "stop") || !fake_rules(&spin.rules, &spin.philo))
+		return ;
+	spin.m = m;
+	c.unit = "ns/call";
+	c.fn = stop_round;
+	c.ctx = &spin;
+	snprintf(c.name, sizeof(c.name), "get_stop uncontended");
+	collect(m, &c);
+	start_spinners(m, &spin);
+	snprintf(c.name, sizeof(c.name), "get_stop vs %d spinners", spin.count);
+	collect(m, &c);
+	stop_spinners(&spin);
+	drop_rules(&spin.rules);
+}
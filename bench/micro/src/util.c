@@ -0,0 +1,51 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   util.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 20:12:55 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 20:12:55 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_micro.h"
+
+int	pin_cpu(int cpu)
+{
+	cpu_set_t	set;
+
+	CPU_ZERO(&set);
+	CPU_SET(cpu, &set);
+	return (sched_setaffinity(0, sizeof(set), &set) == 0);
+}
+
+int	selected(t_micro *m, char *group)
+{
+	return (!m->only || strstr(m->only, group));
+}
+
+int	fake_rules(t_rules *rules, t_philo *philo)
+{
+	memset(rules, 0, sizeof(t_rules));
+	memset(philo, 0, sizeof(t_philo));
+	if (pthread_mutex_init(&rules->stop_mutex, NULL) != 0)
+		return (0);
+	if (pthread_mutex_init(&rules->print_mutex, NULL) != 0)
+	{
+		pthread_mutex_destroy(&rules->stop_mutex);
+		return (0);
+	}
+	rules->num = 1;
+	rules->start = get_time_ms();
+	philo->id = 1;
+	philo->rules = rules;
+	return (1);
+}
+
+void	drop_rules(t_rules *rules)
+{
+	pthread_mutex_destroy(&rules->stop_mutex);
+	pthread_mutex_destroy(&rules->print_mutex);
+}
@@ -0,0 +1,84 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   philo_bench.h                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:54:47 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 19:54:47 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PHILO_BENCH_H
+# define PHILO_BENCH_H
+
+# include <signal.h>
+# include <stdio.h>
+# include <stdlib.h>
+# include <string.h>
+# include <sys/resource.h>
+# include <sys/time.h>
+# include <sys/wait.h>
+# include <time.h>
+# include <unistd.h>
+
+# define GRID_MAX 16
+# define BASE_MAX 4096
+# define DEFAULT_MEALS 5
+# define DEFAULT_TIMEOUT 60
+# define DEFAULT_THRESHOLD 10
+
+typedef struct s_case
+{
+	int			bin;
+	long		n;
+	long		die;
+	long		eat;
+	long		sleep;
+}				t_case;
+
+typedef struct s_result
+{
+	t_case		c;
+	long		meals;
+	long		wall_ms;
+	double		meals_per_s;
+	double		cpu_us_per_meal;
+	long		ctx_switches;
+	long		peak_rss_kb;
+	int			died;
+}				t_result;
+
+typedef struct s_list
+{
+	long		v[GRID_MAX];
+	int			len;
+}				t_list;
+
+typedef struct s_bench
+{
+	t_list		n;
+	t_list		die;
+	t_list		eat;
+	t_list		sleep;
+	long		must_eat;
+	long		timeout;
+	long		threshold;
+	char		*bins[2];
+	char		*out;
+	char		*compare;
+	t_result	*base;
+	int			base_len;
+	int			regressions;
+}				t_bench;
+
+int				parse_args(t_bench *bench, int ac, char **av);
+int				run_case(t_bench *bench, t_case *c, t_result *res);
+void			write_result(FILE *out, t_result *res, int last);
+void			fill_result(t_result *res, struct rusage *ru);
+char			*bin_name(int bin);
+int				load_baseline(t_bench *bench);
+void			compare_result(t_bench *bench, t_result *res);
+
+#endif
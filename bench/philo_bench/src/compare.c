@@ -0,0 +1,114 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   compare.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:55:26 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 19:55:26 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_bench.h"
+
+static int	parse_line(char *line, t_result *res)
+{
+	char	name[16];
+
+	memset(res, 0, sizeof(t_result));
+	if (sscanf(line, " {\"binary\": \"%15[^\"]\", \"n\": %ld, \"die\": %ld, "
+			"\"eat\": %ld, \"sleep\": %ld, \"meals\": %ld, \"wall_ms\": %ld, "
+			"\"meals_per_s\": %lf, \"cpu_us_per_meal\": %lf, "
+			"\"ctx_switches\": %ld, \"peak_rss_kb\": %ld, \"died\": %d",
+			name, &res->c.n, &res->c.die, &res->c.eat, &res->c.sleep,
+			&res->meals, &res->wall_ms, &res->meals_per_s,
+			&res->cpu_us_per_meal, &res->ctx_switches, &res->peak_rss_kb,
+			&res->died) != 12)
+		return (0);
+	res->c.bin = (strcmp(name, "philo") != 0);
+	return (1);
+}
+
+int	load_baseline(t_bench *bench)
+{
+	FILE	*in;
+	char	*line;
+	size_t	cap;
+
+	in = fopen(bench->compare, "r");
+	bench->base = malloc(sizeof(t_result) * BASE_MAX);
+	if (!in || !bench->base)
+		return (0);
+	line = NULL;
+	cap = 0;
+	while (getline(&line, &cap, in) > 0 && bench->base_len < BASE_MAX)
+	{
+		if (parse_line(line, &bench->base[bench->base_len]))
+			bench->base_len++;
+	}
+	free(line);
+	fclose(in);
+	return (bench->base_len > 0);
+}
+
+static t_result	*find_base(t_bench *bench, t_case *c)
+{
+	int	idx;
+
+	idx = 0;
+	while (idx < bench->base_len)
+	{
+		if (bench->base[idx].c.bin == c->bin && bench->base[idx].c.n == c->n
+			&& bench->base[idx].c.die == c->die
+			&& bench->base[idx].c.eat == c->eat
+			&& bench->base[idx].c.sleep == c->sleep)
+			return (&bench->base[idx]);
+		idx++;
+	}
+	return (NULL);
+}
+
+static int	check(char *name, double base, double now, long threshold)
+{
+	double	change;
+
+	change = 0;
+	if (base > 0)
+		change = (now - base) * 100.0 / base;
+	fprintf(stderr, "  %s %.2f -> %.2f (%+.1f%%)", name, base, now, change);
+	if (threshold < 0)
+		change = -change;
+	if (base > 0 && change > labs(threshold))
+	{
+		fprintf(stderr, " REGRESSION");
+		return (1);
+	}
+	return (0);
+}
+
+void	compare_result(t_bench *bench, t_result *res)
+{
+	t_result	*base;
+	int			bad;
+
+	base = find_base(bench, &res->c);
+	fprintf(stderr, "%s %ld %ld %ld %ld:", bin_name(res->c.bin), res->c.n,
+		res->c.die, res->c.eat, res->c.sleep);
+	if (!base)
+	{
+		fprintf(stderr, " not in baseline\n");
+		return ;
+	}
+	bad = check("meals/s", base->meals_per_s, res->meals_per_s,
+			-bench->threshold);
+	bad += check("cpu_us/meal", base->cpu_us_per_meal, res->cpu_us_per_meal,
+			bench->threshold);
+	bad += check("rss_kb", base->peak_rss_kb, res->peak_rss_kb,
+			bench->threshold);
+	if (res->died && !base->died)
+		fprintf(stderr, "  new death REGRESSION");
+	bad += (res->died && !base->died);
+	fprintf(stderr, "\n");
+	bench->regressions += (bad > 0);
+}
@@ -0,0 +1,102 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   main.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:55:26 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 19:55:26 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_bench.h"
+
+static int	usage(void)
+{
+	fprintf(stderr, "Usage: ./philo_bench [OPTIONS]\n\n"
+		"  --n=LIST          philosopher counts (5,50,200)\n"
+		"  --die=LIST        time to die in ms (800)\n"
+		"  --eat=LIST        time to eat in ms (100,200)\n"
+		"  --sleep=LIST      time to sleep in ms (100,200)\n"
+		"  --meals=N         meals per philosopher in every run (5)\n"
+		"  --timeout=S       kill a run after S seconds (60)\n"
+		"  --philo=PATH      philo binary (../../philo/philo)\n"
+		"  --bonus=PATH      philo_bonus binary "
+		"(../../philo_bonus/philo_bonus)\n"
+		"  --out=FILE        write JSON results to FILE instead of stdout\n"
+		"  --compare=FILE    compare against a saved results file\n"
+		"  --threshold=PCT   regression threshold in percent (10)\n");
+	return (2);
+}
+
+static int	case_count(t_bench *bench)
+{
+	return (2 * bench->n.len * bench->die.len * bench->eat.len
+		* bench->sleep.len);
+}
+
+static void	case_at(t_bench *bench, int idx, t_case *c)
+{
+	c->bin = idx % 2;
+	idx /= 2;
+	c->sleep = bench->sleep.v[idx % bench->sleep.len];
+	idx /= bench->sleep.len;
+	c->eat = bench->eat.v[idx % bench->eat.len];
+	idx /= bench->eat.len;
+	c->die = bench->die.v[idx % bench->die.len];
+	idx /= bench->die.len;
+	c->n = bench->n.v[idx % bench->n.len];
+}
+
+static int	run_grid(t_bench *bench, FILE *out)
+{
+	t_case		c;
+	t_result	res;
+	int			idx;
+	int			total;
+
+	total = case_count(bench);
+	fprintf(out, "{\n  \"meals_per_philo\": %ld,\n  \"results\": [\n",
+		bench->must_eat);
+	idx = 0;
+	while (idx < total)
+	{
+		case_at(bench, idx, &c);
+		if (!run_case(bench, &c, &res))
+			perror("philo_bench");
+		write_result(out, &res, idx == total - 1);
+		if (bench->compare)
+			compare_result(bench, &res);
+		idx++;
+	}
+	fprintf(out, "  ]\n}\n");
+	return (bench->regressions);
+}
+
+int	main(int ac, char **av)
+{
+	t_bench	bench;
+	FILE	*out;
+	int		regressions;
+
+	if (!parse_args(&bench, ac, av))
+		return (usage());
+	if (bench.compare && !load_baseline(&bench))
+	{
+		fprintf(stderr, "Error: cannot read baseline %s\n", bench.compare);
+		return (2);
+	}
+	out = stdout;
+	if (bench.out)
+		out = fopen(bench.out, "w");
+	if (!out)
+		return (usage());
+	regressions = run_grid(&bench, out);
+	if (out != stdout)
+		fclose(out);
+	free(bench.base);
+	if (regressions)
+		fprintf(stderr, "%d regression(s)\n", regressions);
+	return (regressions > 0);
+}
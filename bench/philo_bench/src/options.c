@@ -0,0 +1,101 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   options.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:54:47 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 19:54:47 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_bench.h"
+
+static int	parse_list(char *arg, t_list *list)
+{
+	char	*end;
+
+	list->len = 0;
+	while (*arg && list->len < GRID_MAX)
+	{
+		list->v[list->len] = strtol(arg, &end, 10);
+		if (end == arg || list->v[list->len] <= 0)
+			return (0);
+		list->len++;
+		arg = end;
+		if (*arg == ',')
+			arg++;
+		else if (*arg)
+			return (0);
+	}
+	return (list->len > 0 && *arg == '\0');
+}
+
+static int	parse_num(char *arg, long *dst)
+{
+	t_list	list;
+
+	if (!parse_list(arg, &list) || list.len != 1)
+		return (0);
+	*dst = list.v[0];
+	return (1);
+}
+
+static void	set_defaults(t_bench *bench)
+{
+	memset(bench, 0, sizeof(t_bench));
+	parse_list("5,50,200", &bench->n);
+	parse_list("800", &bench->die);
+	parse_list("100,200", &bench->eat);
+	parse_list("100,200", &bench->sleep);
+	bench->must_eat = DEFAULT_MEALS;
+	bench->timeout = DEFAULT_TIMEOUT;
+	bench->threshold = DEFAULT_THRESHOLD;
+	bench->bins[0] = "../../philo/philo";
+	bench->bins[1] = "../../philo_bonus/philo_bonus";
+}
+
+static int	set_option(t_bench *bench, char *arg)
+{
+	if (strncmp(arg, "--n=", 4) == 0)
+		return (parse_list(arg + 4, &bench->n));
+	if (strncmp(arg, "--die=", 6) == 0)
+		return (parse_list(arg + 6, &bench->die));
+	if (strncmp(arg, "--eat=", 6) == 0)
+		return (parse_list(arg + 6, &bench->eat));
+	if (strncmp(arg, "--sleep=", 8) == 0)
+		return (parse_list(arg + 8, &bench->sleep));
+	if (strncmp(arg, "--meals=", 8) == 0)
+		return (parse_num(arg + 8, &bench->must_eat));
+	if (strncmp(arg, "--timeout=", 10) == 0)
+		return (parse_num(arg + 10, &bench->timeout));
+	if (strncmp(arg, "--threshold=", 12) == 0)
+		return (parse_num(arg + 12, &bench->threshold));
+	if (strncmp(arg, "--philo=", 8) == 0)
+		bench->bins[0] = arg + 8;
+	else if (strncmp(arg, "--bonus=", 8) == 0)
+		bench->bins[1] = arg + 8;
+	else if (strncmp(arg, "--out=", 6) == 0)
+		bench->out = arg + 6;
+	else if (strncmp(arg, "--compare=", 10) == 0)
+		bench->compare = arg + 10;
+	else
+		return (0);
+	return (1);
+}
+
+int	parse_args(t_bench *bench, int ac, char **av)
+{
+	int	idx;
+
+	set_defaults(bench);
+	idx = 1;
+	while (idx < ac)
+	{
+		if (!set_option(bench, av[idx]))
+			return (0);
+		idx++;
+	}
+	return (1);
+}
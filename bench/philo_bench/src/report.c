@@ -0,0 +1,51 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   report.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:55:04 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 19:55:04 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_bench.h"
+
+char	*bin_name(int bin)
+{
+	if (bin == 0)
+		return ("philo");
+	return ("philo_bonus");
+}
+
+void	write_result(FILE *out, t_result *res, int last)
+{
+	char	*sep;
+
+	sep = ",";
+	if (last)
+		sep = "";
+	fprintf(out, "    {\"binary\": \"%s\", \"n\": %ld, \"die\": %ld, "
+		"\"eat\": %ld, \"sleep\": %ld, \"meals\": %ld, \"wall_ms\": %ld, "
+		"\"meals_per_s\": %.2f, \"cpu_us_per_meal\": %.2f, "
+		"\"ctx_switches\": %ld, \"peak_rss_kb\": %ld, \"died\": %d}%s\n",
+		bin_name(res->c.bin), res->c.n, res->c.die, res->c.eat,
+		res->c.sleep, res->meals, res->wall_ms, res->meals_per_s,
+		res->cpu_us_per_meal, res->ctx_switches, res->peak_rss_kb,
+		res->died, sep);
+}
+
+void	fill_result(t_result *res, struct rusage *ru)
+{
+	double	cpu_us;
+
+	cpu_us = (ru->ru_utime.tv_sec + ru->ru_stime.tv_sec) * 1e6
+		+ ru->ru_utime.tv_usec + ru->ru_stime.tv_usec;
+	if (res->meals > 0)
+		res->cpu_us_per_meal = cpu_us / res->meals;
+	if (res->wall_ms > 0)
+		res->meals_per_s = res->meals * 1000.0 / res->wall_ms;
+	res->ctx_switches = ru->ru_nvcsw + ru->ru_nivcsw;
+	res->peak_rss_kb = ru->ru_maxrss;
+}
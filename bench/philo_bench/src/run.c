@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   run.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:55:04 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 19:55:04 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_bench.h"
+
+static long	now_ms(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
+
+static void	exec_case(t_bench *bench, t_case *c, int out_fd)
+{
+	char	args[5][24];
+	char	*argv[7];
+	long	vals[5];
+	int		idx;
+
+	vals[0] = c->n;
+	vals[1] = c->die;
+	vals[2] = c->eat;
+	vals[3] = c->sleep;
+	vals[4] = bench->must_eat;
+	argv[0] = bench->bins[c->bin];
+	idx = 0;
+	while (idx < 5)
+	{
+		snprintf(args[idx], sizeof(args[idx]), "%ld", vals[idx]);
+		argv[idx + 1] = args[idx];
+		idx++;
+	}
+	argv[6] = NULL;
+	dup2(out_fd, STDOUT_FILENO);
+	close(out_fd);
+	alarm(bench->timeout);
+	execv(argv[0], argv);
+	perror(argv[0]);
+	_exit(127);
+}
+
+static void	count_output(int fd, t_result *res)
+{
+	FILE	*in;
+	char	*line;
+	size_t	cap;
+
+	in = fdopen(fd, "r");
+	if (!in)
+		return ;
+	line = NULL;
+	cap = 0;
+	while (getline(&line, &cap, in) > 0)
+	{
+		if (strstr(line, " is eating"))
+			res->meals++;
+		else if (strstr(line, " died"))
+			res->died = 1;
+	}
+	free(line);
+	fclose(in);
+}
+
+static pid_t	spawn(t_bench *bench, t_case *c, int *fds)
+{
+	pid_t	pid;
+
+	pid = fork();
+	if (pid == 0)
+	{
+		close(fds[0]);
+		exec_case(bench, c, fds[1]);
+	}
+	close(fds[1]);
+	if (pid < 0)
+		close(fds[0]);
+	return (pid);
+}
+
+int	run_case(t_bench *bench, t_case *c, t_result *res)
+{
+	int				fds[2];
+	pid_t			pid;
+	struct rusage	ru;
+	long			start;
+
+	memset(res, 0, sizeof(t_result));
+	res->c = *c;
+	if (pipe(fds) != 0)
+		return (0);
+	start = now_ms();
+	pid = spawn(bench, c, fds);
+	if (pid < 0)
+		return (0);
+	count_output(fds[0], res);
+	if (wait4(pid, NULL, 0, &ru) < 0)
+		return (0);
+	res->wall_ms = now_ms() - start;
+	fill_result(res, &ru);
+	return (1);
+}
@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   probe_bench.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:47:59 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 19:47:59 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+#ifdef PROBES_SDT
+# define PROBES_KIND "sys/sdt.h"
+#else
+# define PROBES_KIND "no-op fallback"
+#endif
+
+#define ROUNDS 9
+#define CALLS 20000000
+
+static long	now_ns(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000000000L + ts.tv_nsec);
+}
+
+static void	sort_samples(double *samples, int count)
+{
+	double	key;
+	int		idx;
+	int		pos;
+
+	idx = 1;
+	while (idx < count)
+	{
+		key = samples[idx];
+		pos = idx - 1;
+		while (pos >= 0 && samples[pos] > key)
+		{
+			samples[pos + 1] = samples[pos];
+			pos--;
+		}
+		samples[pos + 1] = key;
+		idx++;
+	}
+}
+
+static double	measure(int which, long calls)
+{
+	volatile long	sink;
+	long			start;
+	long			idx;
+
+	sink = 0;
+	start = now_ns();
+	idx = 0;
+	while (idx < calls)
+	{
+		sink += idx;
+		if (which == 1)
+			probe_state(1, ST_THINKING, idx);
+		else if (which == 2)
+			probe_fork(1, 1, 0);
+		idx++;
+	}
+	return ((double)(now_ns() - start) / calls);
+}
+
+static double	report(char *name, int which, double base)
+{
+	double	samples[ROUNDS];
+	int		round;
+
+	round = 0;
+	while (round < ROUNDS)
+	{
+		samples[round] = measure(which, CALLS);
+		round++;
+	}
+	sort_samples(samples, ROUNDS);
+	if (base < 0)
+		base = samples[ROUNDS / 2];
+	printf("%-12s median %6.2f ns  min %6.2f  max %6.2f  probe cost %6.2f ns\n",
+		name, samples[ROUNDS / 2], samples[0], samples[ROUNDS - 1],
+		samples[ROUNDS / 2] - base);
+	return (samples[ROUNDS / 2]);
+}
+
+int	main(void)
+{
+	double	base;
+
+	printf("probes: %s, %d rounds of %d calls\n", PROBES_KIND, ROUNDS, CALLS);
+	base = report("loop", 0, -1);
+	report("probe_state", 1, base);
+	report("probe_fork", 2, base);
+	return (0);
+}
@@ -0,0 +1,113 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   libphilo.h                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 20:26:07 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 20:54:35 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef LIBPHILO_H
+# define LIBPHILO_H
+
+# define PHILO_EV_FORK 1
+# define PHILO_EV_EAT 2
+# define PHILO_EV_SLEEP 3
+# define PHILO_EV_THINK 4
+# define PHILO_EV_DIED 5
+# define PHILO_EV_LOW_SLACK 6
+# define PHILO_EV_SUMMARY 7
+# define PHILO_MAX_DEFAULT 200
+# define PHILO_MAX_LIMIT 16384
+# define PHILO_STACK_DEFAULT 32768
+
+typedef struct s_rules	t_philo_sim;
+
+typedef struct s_philo_summary
+{
+	long				meals;
+	long				total;
+	int					eating;
+	long				min_slack;
+	int					slack_id;
+}						t_philo_summary;
+
+typedef struct s_philo_event
+{
+	long				ts;
+	int					id;
+	int					kind;
+	long				arg;
+	t_philo_summary		*summary;
+}						t_philo_event;
+
+typedef void			(*t_philo_event_fn)(void *ctx, t_philo_event *ev);
+
+typedef struct s_philo_config
+{
+	int					num;
+	long				t_die;
+	long				t_eat;
+	long				t_sleep;
+	int					must_eat;
+	long				margin;
+	long				warn_slack;
+	int					metrics;
+	int					record;
+	long				summary;
+	long				max_num;
+	long				stack_size;
+	int					low_jitter;
+	t_philo_event_fn	on_event;
+	void				*ctx;
+}						t_philo_config;
+
+typedef struct s_philo_stats
+{
+	long				duration_ms;
+	long				meals;
+	int					min_meals;
+	int					died_id;
+	long				died_ms;
+}						t_philo_stats;
+
+typedef struct s_philo_memory
+{
+	long				stack_reserved;
+	long				stack_touched_max;
+	long				stack_touched_avg;
+	long				heap;
+	long				per_philo;
+}						t_philo_memory;
+
+typedef struct s_philo_jitter
+{
+	int					timer_slack;
+	int					locked;
+	int					realtime;
+	long				wake_p50;
+	long				wake_p99;
+	long				wake_max;
+}						t_philo_jitter;
+
+typedef struct s_tev
+{
+	long				ts;
+	int					state;
+}						t_tev;
+
+void					philo_config_init(t_philo_config *cfg);
+t_philo_sim				*philo_create(t_philo_config *cfg);
+char					*philo_error(t_philo_sim *sim);
+int						philo_run(t_philo_sim *sim);
+void					philo_stats(t_philo_sim *sim, t_philo_stats *out);
+void					philo_memory(t_philo_sim *sim, t_philo_memory *out);
+void					philo_jitter(t_philo_sim *sim, t_philo_jitter *out);
+int						philo_meals(t_philo_sim *sim, int id);
+long					philo_timeline(t_philo_sim *sim, int id, t_tev **ev);
+void					philo_destroy(t_philo_sim *sim);
+
+#endif
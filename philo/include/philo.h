@@ -6,28 +6,122 @@
 /*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/22 23:03:17 by eabdelfa          #+#    #+#             */
-/*   Updated: 2026/01/26 19:38:08 by eabdelfa         ###   ########.fr       */
+/*   Updated: 2026/10/18 21:07:09 by eabdelfa         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #ifndef PHILO_H
 # define PHILO_H
 
+# include <fcntl.h>
 # include <limits.h>
 # include <pthread.h>
+# include <sched.h>
 # include <stdio.h>
 # include <stdlib.h>
 # include <string.h>
+# include <sys/mman.h>
+# include <sys/prctl.h>
 # include <sys/time.h>
+# include <time.h>
 # include <unistd.h>
+# include "libphilo.h"
+# include "metrics.h"
+
+# define DEFAULT_MARGIN 10
+# define HIST_SUB_BITS 4
+# define HIST_SUB 16
+# define HIST_BUCKETS 512
+# define LOCK_STOP 0
+# define LOCK_PRINT 1
+# define LOCK_FORKS 2
+# define TRACE_CAP 8192
+# define PLAN_LANES 4
+# define PLAN_CHUNK 1024
+# define PLAN_SIZE 4096
+# define GRID_MEALS 10
 
 typedef struct s_rules	t_rules;
+typedef long			t_v4 __attribute__((vector_size(32)));
+
+typedef struct s_think
+{
+	long				wait_est;
+	long				decisions;
+	long				total;
+	long				capped;
+	long				min_budget;
+}						t_think;
+
+typedef struct s_hist
+{
+	long				count;
+	long				sum;
+	long				min;
+	long				max;
+	long				below;
+	unsigned int		bins[HIST_BUCKETS];
+}						t_hist;
+
+typedef struct s_lat
+{
+	t_hist				fork_wait;
+	t_hist				eat;
+	t_hist				sleep;
+	t_hist				meal_gap;
+	t_hist				slack;
+	long				min_slack;
+	long				warnings;
+	long				last_meal_us;
+}						t_lat;
+
+typedef struct s_tbuf
+{
+	long				count;
+	long				dropped;
+	t_tev				ev[TRACE_CAP];
+}						t_tbuf;
+
+typedef struct s_lockprof
+{
+	int					id;
+	long				count;
+	long				wait_ns;
+	long				wait_max;
+	long				hold_ns;
+	long				hold_max;
+	long				since;
+}						t_lockprof;
+
+typedef struct s_jit
+{
+	int					slack;
+	int					locked;
+	int					fifo;
+	int					policy;
+	struct sched_param	param;
+	t_hist				wake;
+}						t_jit;
+
+typedef struct s_sum
+{
+	long				next;
+	long				total;
+	long				worst_age;
+	int					worst_id;
+	long				pending;
+	t_philo_summary		snap;
+}						t_sum;
 
 typedef struct s_philo
 {
 	int					id;
 	int					meals;
+	int					eating;
 	long				last_meal;
+	long				slot;
+	t_think				think;
+	t_lat				lat;
 	pthread_t			thread;
 	pthread_mutex_t		meal_mutex;
 	pthread_mutex_t		*left;
@@ -44,6 +138,15 @@ struct					s_rules
 	int					must_eat;
 	int					has_must;
 	long				start;
+	long				end;
+	long				margin;
+	long				period;
+	int					phases;
+	long				warn_slack;
+	int					metrics;
+	char				mname[METRICS_NAME_MAX];
+	size_t				msize;
+	t_mpage				*mpage;
 	int					stop;
 	int					stop_init;
 	int					print_init;
@@ -53,15 +156,110 @@ struct					s_rules
 	pthread_mutex_t		print_mutex;
 	pthread_mutex_t		*forks;
 	t_philo				*philos;
+	long				stack_size;
+	long				stack_stride;
+	char				*stacks;
+	t_philo_memory		mem;
+	int					low_jitter;
+	t_jit				jit;
+	t_lockprof			*lockprof;
+	int					record;
+	long				summary;
+	t_sum				sum;
+	t_tbuf				*trace;
+	int					death_id;
+	long				death_us;
+	t_philo_event_fn	on_event;
+	void				*event_ctx;
+	char				*error;
 };
 
-int						init_rules(t_rules *rules, int ac, char **av);
-int						parse_rules(t_rules *rules, int ac, char **av);
+typedef struct s_cli
+{
+	t_philo_config		cfg;
+	int					stats;
+	long				stack_kb;
+	char				*trace_path;
+	char				*batch_path;
+	char				*batch_logs;
+	long				jobs;
+	int					analyze;
+	char				*grid;
+}						t_cli;
+
+typedef struct s_plan
+{
+	t_v4				num[PLAN_CHUNK];
+	t_v4				die[PLAN_CHUNK];
+	t_v4				eat[PLAN_CHUNK];
+	t_v4				sleep[PLAN_CHUNK];
+	t_v4				period[PLAN_CHUNK];
+	t_v4				phases[PLAN_CHUNK];
+	t_v4				slack[PLAN_CHUNK];
+	t_v4				survive[PLAN_CHUNK];
+	long				margin;
+	int					count;
+}						t_plan;
+
+typedef struct s_range
+{
+	long				lo;
+	long				hi;
+	long				step;
+}						t_range;
+
+typedef struct s_grid
+{
+	t_range				axis[4];
+	long				meals;
+	long				total;
+	long				survive;
+	long				tight;
+	long				eval_us;
+}						t_grid;
+
+typedef struct s_table
+{
+	t_philo_config		cfg;
+	t_philo_stats		stats;
+	char				*log;
+	long				log_len;
+	long				log_cap;
+	long				lines;
+	char				*error;
+}						t_table;
+
+typedef struct s_batch
+{
+	t_table				*tables;
+	int					count;
+	int					cap;
+	int					next;
+	int					jobs;
+	long				wall_ms;
+	char				*log_dir;
+	t_plan				*plan;
+	long				mismatches;
+	pthread_mutex_t		lock;
+}						t_batch;
+
+int						parse_options(t_cli *cli, int ac, char **av);
+int						init_rules(t_rules *rules);
+int						check_config(t_philo_config *cfg);
+int						parse_rules(t_philo_config *cfg, int ac, char **av);
 int						init_philos(t_rules *rules);
 int						init_mutexes(t_rules *rules);
 void					cleanup_partial_init(t_rules *rules);
 int						start_simulation(t_rules *rules);
 void					cleanup_rules(t_rules *rules);
+int						open_stacks(t_rules *rules);
+void					close_stacks(t_rules *rules);
+int						spawn_philo(t_rules *rules, int idx);
+void					measure_stacks(t_rules *rules);
+void					jitter_setup(t_rules *rules);
+void					jitter_thread(t_rules *rules);
+void					jitter_restore(t_rules *rules);
+void					monitor_nap(t_rules *rules);
 
 void					*philo_routine(void *arg);
 void					take_forks(t_philo *philo);
@@ -70,17 +268,73 @@ void					eat(t_philo *philo);
 void					update_meal_time(t_philo *philo, long now);
 void					increment_meals(t_philo *philo);
 void					monitor_simulation(t_rules *rules);
+void					sum_sample(t_rules *rules, int idx, long age);
+void					sum_tick(t_rules *rules, int final);
+void					build_schedule(t_rules *rules);
+long					slot_offset(t_rules *rules, int id);
+long					slot_wait(t_philo *philo, long now);
+void					adaptive_think(t_philo *philo);
+void					record_fork_wait(t_philo *philo, long wait);
+void					print_stats(t_rules *rules);
+void					print_latency(t_rules *rules);
+void					print_hist(char *name, t_hist *hist, char *sep);
+void					print_jitter(t_rules *rules);
+void					hist_record(t_hist *hist, long value);
+void					hist_merge(t_hist *dst, t_hist *src);
+long					hist_quantile(t_hist *hist, long q);
+void					timed_usleep(t_philo *philo, t_hist *hist, long ms);
+void					note_meal(t_philo *philo, long now_us);
+void					lat_merge(t_lat *dst, t_lat *src);
+int						open_metrics(t_rules *rules);
+void					close_metrics(t_rules *rules);
+void					publish_start(t_rules *rules);
+void					publish_state(t_philo *philo, int state);
+void					publish_meal(t_philo *philo, long now);
+void					publish_meals(t_philo *philo, int meals);
 
 long					get_time_ms(void);
+long					get_time_us(void);
 void					ft_usleep(t_rules *rules, long ms);
 
 int						is_positive_number(char *s);
 long					ft_atol(char *s);
 size_t					ft_strlen(char *s);
+int						ft_strncmp(char *s1, char *s2, size_t n);
 
+void					lock_mutex(t_rules *rules, pthread_mutex_t *mutex);
+void					unlock_mutex(t_rules *rules, pthread_mutex_t *mutex);
+int						open_lockprof(t_rules *rules);
+void					close_lockprof(t_rules *rules);
+void					print_lockprof(t_rules *rules);
+int						open_trace(t_rules *rules);
+void					close_trace(t_rules *rules);
+void					trace_mark(t_philo *philo, int state);
+void					trace_death(t_philo *philo);
+int						write_trace(t_rules *rules, char *path);
+void					probe_fork(int id, int fork, int taken);
+void					probe_release(int id);
+void					probe_state(int id, int state, long arg);
+void					probe_sim(t_rules *rules, int running);
 int						get_stop(t_rules *rules);
 void					set_stop(t_rules *rules);
-void					print_state(t_philo *philo, char *msg, int force);
+int						set_error(t_rules *rules, char *msg);
+void					print_state(t_philo *philo, int state, int force);
+void					emit_event(t_rules *rules, t_philo_event *ev);
+
+int						format_event(char *buf, size_t size, t_philo_event *ev);
+int						run_batch(t_cli *cli);
+int						read_batch(t_batch *batch, t_cli *cli);
+int						run_pool(t_batch *batch);
+void					report_batch(t_batch *batch);
+void					save_table_log(t_batch *batch, t_table *table, int idx);
+void					plan_set(t_plan *plan, int lane, t_philo_config *cfg);
+void					plan_run(t_plan *plan);
+t_plan					*plan_alloc(long margin);
+void					print_plan(t_plan *plan, int lane);
+int						run_analyze(t_cli *cli);
+int						run_grid(t_cli *cli);
+void					flush_grid(t_grid *g, t_plan *plan);
+void					report_grid(t_grid *g);
 
 void					print_error(char *msg);
 void					print_usage(void);
@@ -0,0 +1,74 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   analyze.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 21:01:21 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 21:01:21 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+t_plan	*plan_alloc(long margin)
+{
+	t_plan	*plan;
+
+	plan = aligned_alloc(sizeof(t_v4), sizeof(t_plan));
+	if (!plan)
+		return (NULL);
+	plan->count = 0;
+	plan->margin = margin;
+	return (plan);
+}
+
+void	plan_set(t_plan *plan, int lane, t_philo_config *cfg)
+{
+	plan->num[lane / PLAN_LANES][lane % PLAN_LANES] = cfg->num;
+	plan->die[lane / PLAN_LANES][lane % PLAN_LANES] = cfg->t_die;
+	plan->eat[lane / PLAN_LANES][lane % PLAN_LANES] = cfg->t_eat;
+	plan->sleep[lane / PLAN_LANES][lane % PLAN_LANES] = cfg->t_sleep;
+	if (lane >= plan->count)
+		plan->count = lane + 1;
+}
+
+void	print_plan(t_plan *plan, int lane)
+{
+	static char	*bool_str[] = {"false", "true"};
+	long		period;
+	long		slack;
+	long		num;
+	int			survive;
+
+	period = plan->period[lane / PLAN_LANES][lane % PLAN_LANES];
+	slack = plan->slack[lane / PLAN_LANES][lane % PLAN_LANES];
+	num = plan->num[lane / PLAN_LANES][lane % PLAN_LANES];
+	survive = (plan->survive[lane / PLAN_LANES][lane % PLAN_LANES] != 0);
+	printf("\"phases\": %ld, \"period_ms\": %ld, \"slack_ms\": %ld, "
+		"\"survives\": %s, \"tight\": %s, \"meals_per_s\": %.2f",
+		plan->phases[lane / PLAN_LANES][lane % PLAN_LANES], period, slack,
+		bool_str[survive], bool_str[survive && slack < plan->margin],
+		(num > 1) * num * 1000.0 / (period + (period == 0)));
+}
+
+int	run_analyze(t_cli *cli)
+{
+	t_plan	*plan;
+
+	plan = plan_alloc(cli->cfg.margin);
+	if (!plan)
+		return (error_exit("failed to allocate memory", 1));
+	plan_set(plan, 0, &cli->cfg);
+	plan_run(plan);
+	printf("{\"num\": %d, \"t_die\": %ld, \"t_eat\": %ld, \"t_sleep\": %ld, ",
+		cli->cfg.num, cli->cfg.t_die, cli->cfg.t_eat, cli->cfg.t_sleep);
+	print_plan(plan, 0);
+	if (plan->survive[0][0])
+		printf(", \"death_ms\": null}\n");
+	else
+		printf(", \"death_ms\": %ld}\n", cli->cfg.t_die);
+	free(plan);
+	return (0);
+}
@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   analyze_grid.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 21:02:03 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 21:02:03 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static int	take_long(char **s, long *dst)
+{
+	char	*end;
+
+	*dst = strtol(*s, &end, 10);
+	if (end == *s)
+		return (0);
+	*s = end;
+	return (1);
+}
+
+static int	parse_range(char **s, t_range *r)
+{
+	if (!take_long(s, &r->lo))
+		return (0);
+	r->hi = r->lo;
+	r->step = 1;
+	if (**s == ':')
+	{
+		(*s)++;
+		if (!take_long(s, &r->hi))
+			return (0);
+	}
+	if (**s == ':')
+	{
+		(*s)++;
+		if (!take_long(s, &r->step))
+			return (0);
+	}
+	return (r->lo >= 0 && r->hi >= r->lo && r->step >= 1);
+}
+
+static int	parse_grid(char *spec, t_grid *g)
+{
+	int	axis;
+
+	memset(g, 0, sizeof(t_grid));
+	g->meals = GRID_MEALS;
+	axis = 0;
+	while (axis < 4)
+	{
+		if (!parse_range(&spec, &g->axis[axis]))
+			return (0);
+		axis++;
+		if (axis < 4 && *spec++ != ',')
+			return (0);
+	}
+	if (*spec == ',')
+	{
+		spec++;
+		if (!take_long(&spec, &g->meals) || g->meals < 0)
+			return (0);
+	}
+	return (*spec == '\0' && g->axis[0].lo >= 1
+		&& g->axis[0].hi <= INT_MAX);
+}
+
+static int	next_point(t_grid *g, t_philo_config *cfg, long *cur)
+{
+	int	axis;
+
+	cfg->num = (int)cur[0];
+	cfg->t_die = cur[1];
+	cfg->t_eat = cur[2];
+	cfg->t_sleep = cur[3];
+	axis = 3;
+	while (axis >= 0)
+	{
+		cur[axis] += g->axis[axis].step;
+		if (cur[axis] <= g->axis[axis].hi)
+			return (1);
+		cur[axis] = g->axis[axis].lo;
+		axis--;
+	}
+	return (0);
+}
+
+int	run_grid(t_cli *cli)
+{
+	t_grid			g;
+	t_plan			*plan;
+	t_philo_config	cfg;
+	long			cur[4];
+	int				more;
+
+	if (!parse_grid(cli->grid, &g))
+		return (error_exit("--grid expects N,T_DIE,T_EAT,T_SLEEP[,MEALS] "
+				"with each range as LO[:HI[:STEP]]", 1));
+	plan = plan_alloc(cli->cfg.margin);
+	if (!plan)
+		return (error_exit("failed to allocate memory", 1));
+	more = -1;
+	while (++more < 4)
+		cur[more] = g.axis[more].lo;
+	while (more)
+	{
+		more = next_point(&g, &cfg, cur);
+		plan_set(plan, plan->count, &cfg);
+		if (plan->count == PLAN_SIZE || !more)
+			flush_grid(&g, plan);
+	}
+	free(plan);
+	report_grid(&g);
+	return (0);
+}
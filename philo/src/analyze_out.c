@@ -0,0 +1,58 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   analyze_out.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 21:02:03 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 21:02:03 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static void	print_point(t_grid *g, t_plan *p, int lane)
+{
+	static char	*verdict[] = {"dies", "survives"};
+	int			v;
+	int			l;
+	int			survive;
+
+	v = lane / PLAN_LANES;
+	l = lane % PLAN_LANES;
+	survive = (p->survive[v][l] != 0);
+	printf("%ld %ld %ld %ld %ld", p->num[v][l], p->die[v][l], p->eat[v][l],
+		p->sleep[v][l], g->meals);
+	printf(" # %s, slack %ld ms, period %ld ms, %ld phases\n",
+		verdict[survive], p->slack[v][l], p->period[v][l], p->phases[v][l]);
+	g->total++;
+	g->survive += survive;
+	g->tight += (survive && p->slack[v][l] < p->margin);
+}
+
+void	flush_grid(t_grid *g, t_plan *plan)
+{
+	long	begin;
+	int		lane;
+
+	begin = get_time_us();
+	plan_run(plan);
+	g->eval_us += get_time_us() - begin;
+	lane = 0;
+	while (lane < plan->count)
+		print_point(g, plan, lane++);
+	plan->count = 0;
+}
+
+void	report_grid(t_grid *g)
+{
+	double	secs;
+
+	secs = g->eval_us / 1e6;
+	if (secs <= 0)
+		secs = 1e-6;
+	fprintf(stderr, "grid: %ld configurations, %ld survive (%ld tight), "
+		"evaluated in %ld us (%.1f M configurations/s)\n", g->total,
+		g->survive, g->tight, g->eval_us, g->total / secs / 1e6);
+}
@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   analyze_simd.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 21:01:10 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 21:01:10 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static void	plan_odd(t_plan *p, int v)
+{
+	t_v4	busy;
+	t_v4	half;
+	t_v4	odd;
+	t_v4	last;
+	t_v4	closes;
+
+	busy = p->eat[v] + p->sleep[v];
+	busy = busy + ((1 - busy) & (busy < 1));
+	half = p->num[v] / 2;
+	half = half + ((1 - half) & (half < 1));
+	odd = (p->num[v] * p->eat[v] + half - 1) / half;
+	odd = odd + ((busy - odd) & (busy > odd));
+	odd = odd + ((1 - odd) & (odd < 1));
+	last = (p->num[v] - 1) * p->eat[v] % odd;
+	closes = (last >= p->eat[v]) & (last + p->eat[v] <= odd);
+	busy = busy + ((3 * p->eat[v] - busy) & (3 * p->eat[v] > busy));
+	p->period[v] = (odd & closes) | (busy & ~closes);
+	p->phases[v] = (p->num[v] & closes) | (3 & ~closes);
+}
+
+static void	plan_vector(t_plan *p, int v)
+{
+	t_v4	busy;
+	t_v4	even;
+	t_v4	solo;
+	t_v4	pair;
+
+	busy = p->eat[v] + p->sleep[v];
+	busy = busy + ((1 - busy) & (busy < 1));
+	plan_odd(p, v);
+	even = (p->num[v] & 1) == 0;
+	solo = p->num[v] < 2;
+	pair = 2 * p->eat[v];
+	pair = pair + ((busy - pair) & (busy > pair));
+	p->period[v] = (pair & even) | (p->period[v] & ~even);
+	p->phases[v] = (2 & (even | solo)) | (p->phases[v] & ~(even | solo));
+	p->period[v] = (busy & solo) | (p->period[v] & ~solo);
+	p->slack[v] = p->die[v] - p->period[v];
+	p->survive[v] = ~solo & (p->slack[v] > 0);
+}
+
+void	plan_run(t_plan *plan)
+{
+	int	lane;
+	int	v;
+
+	lane = plan->count;
+	while (lane > 0 && lane % PLAN_LANES != 0)
+	{
+		plan->num[lane / PLAN_LANES][lane % PLAN_LANES] = plan->num[0][0];
+		plan->die[lane / PLAN_LANES][lane % PLAN_LANES] = plan->die[0][0];
+		plan->eat[lane / PLAN_LANES][lane % PLAN_LANES] = plan->eat[0][0];
+		plan->sleep[lane / PLAN_LANES][lane % PLAN_LANES] = plan->sleep[0][0];
+		lane++;
+	}
+	v = 0;
+	while (v < lane / PLAN_LANES)
+		plan_vector(plan, v++);
+}
@@ -0,0 +1,68 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   api.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 20:27:27 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 20:54:35 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static int	apply_config(t_rules *rules, t_philo_config *cfg)
+{
+	if (!check_config(cfg))
+		return (set_error(rules, "invalid simulation parameters"));
+	rules->num = cfg->num;
+	rules->t_die = cfg->t_die;
+	rules->t_eat = cfg->t_eat;
+	rules->t_sleep = cfg->t_sleep;
+	rules->must_eat = cfg->must_eat;
+	rules->has_must = (cfg->must_eat >= 0);
+	rules->margin = cfg->margin;
+	rules->warn_slack = cfg->warn_slack;
+	rules->metrics = cfg->metrics;
+	rules->record = cfg->record;
+	rules->summary = cfg->summary;
+	rules->stack_size = cfg->stack_size;
+	rules->low_jitter = cfg->low_jitter;
+	rules->on_event = cfg->on_event;
+	rules->event_ctx = cfg->ctx;
+	return (1);
+}
+
+t_philo_sim	*philo_create(t_philo_config *cfg)
+{
+	t_rules	*rules;
+
+	rules = malloc(sizeof(t_rules));
+	if (!rules)
+		return (NULL);
+	memset(rules, 0, sizeof(t_rules));
+	if (apply_config(rules, cfg) && init_rules(rules))
+		init_philos(rules);
+	return (rules);
+}
+
+char	*philo_error(t_philo_sim *sim)
+{
+	return (sim->error);
+}
+
+int	philo_run(t_philo_sim *sim)
+{
+	if (sim->error)
+		return (1);
+	return (start_simulation(sim));
+}
+
+void	philo_destroy(t_philo_sim *sim)
+{
+	if (!sim)
+		return ;
+	cleanup_rules(sim);
+	free(sim);
+}
@@ -0,0 +1,35 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   api_config.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 20:41:46 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 20:41:46 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+void	philo_config_init(t_philo_config *cfg)
+{
+	memset(cfg, 0, sizeof(t_philo_config));
+	cfg->must_eat = -1;
+	cfg->margin = DEFAULT_MARGIN;
+	cfg->max_num = PHILO_MAX_DEFAULT;
+	cfg->stack_size = PHILO_STACK_DEFAULT;
+}
+
+int	check_config(t_philo_config *cfg)
+{
+	if (cfg->max_num < 1 || cfg->max_num > PHILO_MAX_LIMIT)
+		return (0);
+	if (cfg->num < 1 || cfg->num > cfg->max_num)
+		return (0);
+	if (cfg->t_die < 0 || cfg->t_eat < 0 || cfg->t_sleep < 0)
+		return (0);
+	if (cfg->margin < 0 || cfg->warn_slack < 0 || cfg->summary < 0)
+		return (0);
+	return (cfg->stack_size >= PTHREAD_STACK_MIN);
+}
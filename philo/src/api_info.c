@@ -0,0 +1,65 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   api_info.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 20:27:27 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 20:54:35 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+void	philo_stats(t_philo_sim *sim, t_philo_stats *out)
+{
+	int	idx;
+
+	memset(out, 0, sizeof(t_philo_stats));
+	if (sim->end > sim->start)
+		out->duration_ms = sim->end - sim->start;
+	if (sim->philos && sim->num > 0)
+		out->min_meals = sim->philos[0].meals;
+	idx = 0;
+	while (sim->philos && idx < sim->num)
+	{
+		out->meals += sim->philos[idx].meals;
+		if (sim->philos[idx].meals < out->min_meals)
+			out->min_meals = sim->philos[idx].meals;
+		idx++;
+	}
+	out->died_id = sim->death_id;
+	out->died_ms = sim->death_us / 1000;
+}
+
+int	philo_meals(t_philo_sim *sim, int id)
+{
+	if (!sim->philos || id < 1 || id > sim->num)
+		return (-1);
+	return (sim->philos[id - 1].meals);
+}
+
+long	philo_timeline(t_philo_sim *sim, int id, t_tev **ev)
+{
+	*ev = NULL;
+	if (!sim->trace || id < 1 || id > sim->num)
+		return (0);
+	*ev = sim->trace[id - 1].ev;
+	return (sim->trace[id - 1].count);
+}
+
+void	philo_memory(t_philo_sim *sim, t_philo_memory *out)
+{
+	*out = sim->mem;
+}
+
+void	philo_jitter(t_philo_sim *sim, t_philo_jitter *out)
+{
+	out->timer_slack = sim->jit.slack;
+	out->locked = sim->jit.locked;
+	out->realtime = sim->jit.fifo;
+	out->wake_p50 = hist_quantile(&sim->jit.wake, 5000);
+	out->wake_p99 = hist_quantile(&sim->jit.wake, 9900);
+	out->wake_max = sim->jit.wake.max;
+}
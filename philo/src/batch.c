@@ -0,0 +1,126 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   batch.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 20:56:11 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 21:07:09 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static int	split_line(char *line, char **av)
+{
+	int	ac;
+
+	ac = 1;
+	while (*line)
+	{
+		while (*line == ' ' || *line == '\t' || *line == '\n')
+			*line++ = '\0';
+		if (*line == '\0' || *line == '#')
+			break ;
+		if (ac == 6)
+			return (7);
+		av[ac++] = line;
+		while (*line && *line != ' ' && *line != '\t' && *line != '\n')
+			line++;
+	}
+	return (ac);
+}
+
+static int	add_table(t_batch *batch, t_philo_config *cfg)
+{
+	t_table	*grown;
+
+	if (batch->count == batch->cap)
+	{
+		grown = realloc(batch->tables, sizeof(t_table)
+				* (batch->cap * 2 + 16));
+		if (!grown)
+			return (error_exit("failed to allocate memory", 0));
+		batch->tables = grown;
+		batch->cap = batch->cap * 2 + 16;
+	}
+	memset(&batch->tables[batch->count], 0, sizeof(t_table));
+	batch->tables[batch->count].cfg = *cfg;
+	batch->count++;
+	return (1);
+}
+
+static int	take_line(t_batch *batch, t_cli *cli, char *line, long lineno)
+{
+	t_philo_config	cfg;
+	char			*av[7];
+	int				ac;
+
+	av[0] = "philo";
+	ac = split_line(line, av);
+	if (ac == 1)
+		return (1);
+	cfg = cli->cfg;
+	if (ac != 6 || !parse_rules(&cfg, ac, av))
+	{
+		fprintf(stderr, "Error: batch line %ld: expected N T_DIE T_EAT "
+			"T_SLEEP T_EAT_COUNT\n", lineno);
+		return (0);
+	}
+	return (add_table(batch, &cfg));
+}
+
+int	read_batch(t_batch *batch, t_cli *cli)
+{
+	FILE	*file;
+	char	*line;
+	size_t	size;
+	long	lineno;
+	int		ok;
+
+	file = stdin;
+	if (ft_strncmp(cli->batch_path, "-", 2) != 0)
+		file = fopen(cli->batch_path, "r");
+	if (!file)
+		return (error_exit("cannot open the batch file", 0));
+	line = NULL;
+	size = 0;
+	lineno = 0;
+	ok = 1;
+	while (ok && getline(&line, &size, file) >= 0)
+		ok = take_line(batch, cli, line, ++lineno);
+	free(line);
+	if (file != stdin)
+		fclose(file);
+	if (ok && batch->count == 0)
+		return (error_exit("the batch file has no configuration", 0));
+	return (ok);
+}
+
+int	run_batch(t_cli *cli)
+{
+	t_batch	batch;
+	int		ok;
+
+	memset(&batch, 0, sizeof(t_batch));
+	batch.jobs = cli->jobs;
+	if (batch.jobs == 0)
+		batch.jobs = sysconf(_SC_NPROCESSORS_ONLN);
+	batch.log_dir = cli->batch_logs;
+	cli->cfg.metrics = 0;
+	cli->cfg.record = 0;
+	cli->cfg.low_jitter = 0;
+	ok = read_batch(&batch, cli);
+	if (ok && cli->analyze)
+		batch.plan = plan_alloc(cli->cfg.margin);
+	if (ok && cli->analyze && !batch.plan)
+		ok = error_exit("failed to allocate memory", 0);
+	if (ok)
+		ok = run_pool(&batch);
+	if (ok)
+		report_batch(&batch);
+	free(batch.tables);
+	free(batch.plan);
+	return (!ok);
+}
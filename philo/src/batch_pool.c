@@ -0,0 +1,118 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   batch_pool.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 20:56:11 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 20:56:11 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static void	table_event(void *ctx, t_philo_event *ev)
+{
+	t_table	*table;
+	char	*grown;
+	char	line[128];
+	int		len;
+
+	table = ctx;
+	len = format_event(line, sizeof(line), ev);
+	if (table->log_len + len > table->log_cap)
+	{
+		grown = realloc(table->log, table->log_cap * 2 + 4096);
+		if (!grown)
+		{
+			table->error = "out of memory for the table output";
+			return ;
+		}
+		table->log = grown;
+		table->log_cap = table->log_cap * 2 + 4096;
+	}
+	memcpy(table->log + table->log_len, line, len);
+	table->log_len += len;
+	table->lines++;
+}
+
+static void	run_table(t_batch *batch, t_table *table, int idx)
+{
+	t_philo_sim	*sim;
+
+	table->cfg.on_event = table_event;
+	table->cfg.ctx = table;
+	sim = philo_create(&table->cfg);
+	if (!sim)
+	{
+		table->error = "failed to allocate memory";
+		return ;
+	}
+	if (!philo_error(sim))
+		philo_run(sim);
+	if (philo_error(sim))
+		table->error = philo_error(sim);
+	philo_stats(sim, &table->stats);
+	philo_destroy(sim);
+	save_table_log(batch, table, idx);
+	free(table->log);
+	table->log = NULL;
+}
+
+static void	*batch_worker(void *arg)
+{
+	t_batch	*batch;
+	int		idx;
+
+	batch = (t_batch *)arg;
+	while (1)
+	{
+		pthread_mutex_lock(&batch->lock);
+		idx = batch->next++;
+		pthread_mutex_unlock(&batch->lock);
+		if (idx >= batch->count)
+			return (NULL);
+		run_table(batch, &batch->tables[idx], idx);
+	}
+}
+
+static int	start_workers(t_batch *batch, pthread_t *workers)
+{
+	int	started;
+
+	started = 0;
+	while (started < batch->jobs && pthread_create(&workers[started], NULL,
+			batch_worker, batch) == 0)
+		started++;
+	if (started == 0)
+		batch_worker(batch);
+	return (started);
+}
+
+int	run_pool(t_batch *batch)
+{
+	pthread_t	*workers;
+	long		start;
+	int			started;
+
+	if (batch->jobs > batch->count)
+		batch->jobs = batch->count;
+	workers = malloc(sizeof(pthread_t) * batch->jobs);
+	if (!workers || pthread_mutex_init(&batch->lock, NULL) != 0)
+	{
+		free(workers);
+		return (error_exit("failed to set up the worker pool", 0));
+	}
+	start = get_time_ms();
+	started = start_workers(batch, workers);
+	batch->jobs = started;
+	if (started == 0)
+		batch->jobs = 1;
+	while (started > 0)
+		pthread_join(workers[--started], NULL);
+	batch->wall_ms = get_time_ms() - start;
+	pthread_mutex_destroy(&batch->lock);
+	free(workers);
+	return (1);
+}
@@ -0,0 +1,118 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   batch_report.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 20:56:27 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 21:07:09 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+void	save_table_log(t_batch *batch, t_table *table, int idx)
+{
+	char	path[PATH_MAX];
+	int		fd;
+
+	if (!batch->log_dir)
+		return ;
+	snprintf(path, sizeof(path), "%s/table-%d.log", batch->log_dir, idx + 1);
+	fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0 || write(fd, table->log, table->log_len) != table->log_len)
+		table->error = "failed to write the table output";
+	if (fd >= 0)
+		close(fd);
+}
+
+static void	plan_tables(t_batch *batch, int first)
+{
+	int	idx;
+
+	batch->plan->count = 0;
+	idx = first;
+	while (idx < batch->count && idx - first < PLAN_SIZE)
+	{
+		plan_set(batch->plan, idx - first, &batch->tables[idx].cfg);
+		idx++;
+	}
+	plan_run(batch->plan);
+}
+
+static void	check_table(t_batch *batch, t_table *table, int idx)
+{
+	static char	*verdict[] = {"dies", "survives"};
+	int			lane;
+	int			survive;
+
+	lane = idx % PLAN_SIZE;
+	survive = (batch->plan->survive[lane / PLAN_LANES][lane % PLAN_LANES]
+			!= 0);
+	printf(", ");
+	print_plan(batch->plan, lane);
+	if (table->error)
+		printf(", \"agree\": null");
+	else if (survive == (table->stats.died_id == 0))
+		printf(", \"agree\": true");
+	else
+	{
+		printf(", \"agree\": false");
+		batch->mismatches++;
+		fprintf(stderr, "mismatch: table %d (%d %ld %ld %ld): predicted %s, "
+			"run %s\n", idx + 1, table->cfg.num, table->cfg.t_die,
+			table->cfg.t_eat, table->cfg.t_sleep, verdict[survive],
+			verdict[table->stats.died_id == 0]);
+	}
+}
+
+static void	report_table(t_batch *batch, t_table *table, int idx)
+{
+	t_philo_stats	*st;
+
+	st = &table->stats;
+	printf("{\"table\": %d, \"num\": %d, \"t_die\": %ld, \"t_eat\": %ld, "
+		"\"t_sleep\": %ld, \"must_eat\": %d, \"died_id\": %d, "
+		"\"died_ms\": %ld, \"meals\": %ld, \"min_meals\": %d, "
+		"\"duration_ms\": %ld, \"lines\": %ld, \"error\": ", idx + 1,
+		table->cfg.num, table->cfg.t_die, table->cfg.t_eat,
+		table->cfg.t_sleep, table->cfg.must_eat, st->died_id, st->died_ms,
+		st->meals, st->min_meals, st->duration_ms, table->lines);
+	if (table->error)
+		printf("\"%s\"", table->error);
+	else
+		printf("null");
+	if (batch->plan)
+		check_table(batch, table, idx);
+	printf("}\n");
+}
+
+void	report_batch(t_batch *batch)
+{
+	long	deaths;
+	long	errors;
+	double	secs;
+	int		idx;
+
+	deaths = 0;
+	errors = 0;
+	idx = -1;
+	while (++idx < batch->count)
+	{
+		if (batch->plan && idx % PLAN_SIZE == 0)
+			plan_tables(batch, idx);
+		report_table(batch, &batch->tables[idx], idx);
+		deaths += (batch->tables[idx].stats.died_id > 0);
+		errors += (batch->tables[idx].error != NULL);
+	}
+	secs = batch->wall_ms / 1000.0;
+	if (secs <= 0)
+		secs = 0.001;
+	fprintf(stderr, "batch: %d tables on %d workers in %ld ms "
+		"(%.1f tables/s), %ld deaths, %ld errors", batch->count,
+		batch->jobs, batch->wall_ms, batch->count / secs, deaths, errors);
+	if (batch->plan)
+		fprintf(stderr, ", %ld mismatches", batch->mismatches);
+	fprintf(stderr, "\n");
+}
@@ -6,7 +6,7 @@
 /*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/22 23:02:34 by eabdelfa          #+#    #+#             */
-/*   Updated: 2026/01/25 22:27:11 by eabdelfa         ###   ########.fr       */
+/*   Updated: 2026/10/18 20:50:20 by eabdelfa         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -38,6 +38,10 @@ static void	destroy_philos(t_rules *rules)
 
 void	cleanup_rules(t_rules *rules)
 {
+	close_metrics(rules);
+	close_lockprof(rules);
+	close_trace(rules);
+	close_stacks(rules);
 	if (rules->forks)
 	{
 		destroy_forks(rules);
@@ -6,7 +6,7 @@
 /*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/23 12:00:00 by eabdelfa          #+#    #+#             */
-/*   Updated: 2026/01/23 17:02:44 by eabdelfa         ###   ########.fr       */
+/*   Updated: 2026/10/18 21:07:09 by eabdelfa         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -19,14 +19,53 @@ void	print_error(char *msg)
 	write(2, "\n", 1);
 }
 
+static void	print_batch_options(void)
+{
+	write(2, "  --batch=FILE     run every configuration line of FILE ('-' is"
+		" stdin)\n", 71);
+	write(2, "  --jobs=N         tables run at the same time in batch"
+		" mode\n", 61);
+	write(2, "  --batch-logs=DIR write each table's output to DIR\n", 52);
+	write(2, "  --analyze        predict the outcome instead of running, or"
+		" check\n                   --batch runs against the prediction\n",
+		123);
+	write(2, "  --grid=SPEC      predict N,T_DIE,T_EAT,T_SLEEP[,MEALS] ranges"
+		" LO:HI:STEP\n", 75);
+}
+
+static void	print_options(void)
+{
+	write(2, "\nOptions:\n", 10);
+	write(2, "  --margin=MS      safety margin kept before T_DIE (10)\n", 56);
+	write(2, "  --metrics        publish live metrics under /dev/shm\n", 55);
+	write(2, "  --warn-slack=MS  warn when a meal starts with less"
+		" slack\n", 59);
+	write(2, "  --trace=FILE     write a Chrome trace-event timeline at"
+		" exit\n", 63);
+	write(2, "  --stats          print run statistics as JSON on stderr\n", 58);
+	write(2, "  --summary=MS     print one aggregate line every MS instead of"
+		" events\n", 71);
+	write(2, "  --max-philos=N   raise the limit on N (200, at most"
+		" 16384)\n", 61);
+	write(2, "  --stack=KB       stack size of each philosopher thread"
+		" (32)\n", 62);
+	write(2, "  --low-jitter     1 ns timer slack, locked memory,"
+		" SCHED_FIFO\n", 63);
+	print_batch_options();
+}
+
 void	print_usage(void)
 {
-	write(2, "Usage: ./philo N T_DIE T_EAT T_SLEEP [T_EAT_COUNT]\n", 51);
+	write(2, "Usage: ./philo [OPTIONS] N T_DIE T_EAT T_SLEEP"
+		" [T_EAT_COUNT]\n", 61);
+	write(2, "       ./philo [OPTIONS] --batch=FILE\n", 38);
+	write(2, "       ./philo --grid=SPEC\n", 27);
 	write(2, "\n  N:              number of philosophers (1-200)\n", 50);
 	write(2, "  T_DIE:          time to die in milliseconds (> 60)\n", 53);
 	write(2, "  T_EAT:          time to eat in milliseconds (> 60)\n", 53);
 	write(2, "  T_SLEEP:        time to sleep in milliseconds (> 60)\n", 55);
 	write(2, "  T_EAT_COUNT:    (optional) meals per philosopher\n", 51);
+	print_options();
 }
 
 int	error_exit(char *msg, int code)
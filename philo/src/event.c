@@ -0,0 +1,37 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   event.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 20:55:53 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 20:55:53 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static int	format_summary(char *buf, size_t size, t_philo_event *ev)
+{
+	t_philo_summary	*sum;
+
+	sum = ev->summary;
+	return (snprintf(buf, size, "%ld summary meals=%ld total=%ld eating=%d "
+			"min_slack=%ld slack_id=%d\n", ev->ts, sum->meals, sum->total,
+			sum->eating, sum->min_slack, sum->slack_id));
+}
+
+int	format_event(char *buf, size_t size, t_philo_event *ev)
+{
+	static char	*names[] = {"", "has taken a fork", "is eating",
+		"is sleeping", "is thinking", "died"};
+
+	if (ev->kind == PHILO_EV_SUMMARY)
+		return (format_summary(buf, size, ev));
+	if (ev->kind == PHILO_EV_LOW_SLACK)
+		return (snprintf(buf, size, "%ld %d low slack %ld us\n", ev->ts,
+				ev->id, ev->arg));
+	return (snprintf(buf, size, "%ld %d %s\n", ev->ts, ev->id,
+			names[ev->kind]));
+}
@@ -6,17 +6,30 @@
 /*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/23 12:00:00 by eabdelfa          #+#    #+#             */
-/*   Updated: 2026/01/23 17:02:44 by eabdelfa         ###   ########.fr       */
+/*   Updated: 2026/10/18 20:32:46 by eabdelfa         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "philo.h"
 
+static void	grab_fork(t_philo *philo, pthread_mutex_t *fork, int nth)
+{
+	probe_fork(philo->id, nth, 0);
+	lock_mutex(philo->rules, fork);
+	probe_fork(philo->id, nth, 1);
+	if (nth == 1)
+		publish_state(philo, ST_FORK);
+	print_state(philo, ST_FORK, 0);
+}
+
 void	take_forks(t_philo *philo)
 {
 	pthread_mutex_t	*first;
 	pthread_mutex_t	*second;
+	long			start;
 
+	trace_mark(philo, ST_FORK);
+	start = get_time_us();
 	if (philo->id % 2 == 0)
 	{
 		first = philo->right;
@@ -27,14 +40,16 @@ void	take_forks(t_philo *philo)
 		first = philo->left;
 		second = philo->right;
 	}
-	pthread_mutex_lock(first);
-	print_state(philo, "has taken a fork", 0);
-	pthread_mutex_lock(second);
-	print_state(philo, "has taken a fork", 0);
+	grab_fork(philo, first, 1);
+	grab_fork(philo, second, 2);
+	start = get_time_us() - start;
+	hist_record(&philo->lat.fork_wait, start);
+	record_fork_wait(philo, (start + 500) / 1000);
 }
 
 void	release_forks(t_philo *philo)
 {
-	pthread_mutex_unlock(philo->left);
-	pthread_mutex_unlock(philo->right);
+	unlock_mutex(philo->rules, philo->left);
+	unlock_mutex(philo->rules, philo->right);
+	probe_release(philo->id);
 }
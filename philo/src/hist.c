@@ -0,0 +1,100 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hist.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:08:56 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 19:08:56 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static int	hist_index(unsigned long value)
+{
+	int	msb;
+	int	idx;
+
+	if (value < HIST_SUB)
+		return ((int)value);
+	msb = 63 - __builtin_clzl(value);
+	idx = (msb - HIST_SUB_BITS + 1) * HIST_SUB
+		+ (int)((value >> (msb - HIST_SUB_BITS)) & (HIST_SUB - 1));
+	if (idx >= HIST_BUCKETS)
+		idx = HIST_BUCKETS - 1;
+	return (idx);
+}
+
+static long	hist_value(int idx)
+{
+	int	shift;
+
+	if (idx < HIST_SUB)
+		return (idx);
+	shift = idx / HIST_SUB - 1;
+	return (((long)(HIST_SUB + idx % HIST_SUB) << shift) + (1L << shift) / 2);
+}
+
+void	hist_record(t_hist *hist, long value)
+{
+	if (value < 0)
+	{
+		hist->below++;
+		value = 0;
+	}
+	if (hist->count == 0 || value < hist->min)
+		hist->min = value;
+	if (value > hist->max)
+		hist->max = value;
+	hist->count++;
+	hist->sum += value;
+	hist->bins[hist_index(value)]++;
+}
+
+void	hist_merge(t_hist *dst, t_hist *src)
+{
+	int	idx;
+
+	if (src->count == 0)
+		return ;
+	if (dst->count == 0 || src->min < dst->min)
+		dst->min = src->min;
+	if (src->max > dst->max)
+		dst->max = src->max;
+	dst->count += src->count;
+	dst->sum += src->sum;
+	dst->below += src->below;
+	idx = 0;
+	while (idx < HIST_BUCKETS)
+	{
+		dst->bins[idx] += src->bins[idx];
+		idx++;
+	}
+}
+
+long	hist_quantile(t_hist *hist, long q)
+{
+	long	rank;
+	long	seen;
+	long	value;
+	int		idx;
+
+	if (hist->count == 0)
+		return (0);
+	rank = (hist->count * q + 9999) / 10000;
+	seen = hist->bins[0];
+	idx = 0;
+	while (idx < HIST_BUCKETS - 1 && seen < rank)
+	{
+		idx++;
+		seen += hist->bins[idx];
+	}
+	value = hist_value(idx);
+	if (value < hist->min)
+		value = hist->min;
+	if (value > hist->max)
+		value = hist->max;
+	return (value);
+}
@@ -6,7 +6,7 @@
 /*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/22 23:02:46 by eabdelfa          #+#    #+#             */
-/*   Updated: 2026/01/26 18:17:11 by eabdelfa         ###   ########.fr       */
+/*   Updated: 2026/10/18 20:50:20 by eabdelfa         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -34,14 +34,38 @@ static int	alloc_and_init(t_rules *rules)
 	return (1);
 }
 
-int	init_rules(t_rules *rules, int ac, char **av)
+static int	open_extras(t_rules *rules)
 {
-	if (!parse_rules(rules, ac, av))
+	if (!open_lockprof(rules))
+	{
+		set_error(rules, "failed to allocate lock profile");
 		return (0);
-	if (!alloc_and_init(rules))
+	}
+	if (!open_trace(rules))
+	{
+		set_error(rules, "failed to allocate trace buffers");
+		return (0);
+	}
+	if (!open_stacks(rules))
+	{
+		set_error(rules, "failed to map philosopher stacks");
+		return (0);
+	}
+	if (rules->metrics && !open_metrics(rules))
 	{
-		print_error("failed to allocate memory or initialize mutexes");
+		set_error(rules, "failed to publish metrics page");
 		return (0);
 	}
 	return (1);
 }
+
+int	init_rules(t_rules *rules)
+{
+	build_schedule(rules);
+	if (!alloc_and_init(rules))
+	{
+		set_error(rules, "failed to allocate memory or initialize mutexes");
+		return (0);
+	}
+	return (open_extras(rules));
+}
@@ -0,0 +1,78 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   jitter.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 20:51:30 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 20:51:30 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static void	prefault_stacks(t_rules *rules)
+{
+	long	page;
+	long	off;
+
+	page = rules->stack_stride - rules->stack_size;
+	off = 0;
+	while (rules->stacks && off < rules->stack_stride * rules->num)
+	{
+		if (off % rules->stack_stride >= page)
+			rules->stacks[off] = 0;
+		off += page;
+	}
+}
+
+void	jitter_setup(t_rules *rules)
+{
+	struct sched_param	param;
+
+	if (!rules->low_jitter)
+		return ;
+	rules->jit.slack = (prctl(PR_SET_TIMERSLACK, 1L, 0L, 0L, 0L) == 0);
+	prefault_stacks(rules);
+	rules->jit.locked = (mlockall(MCL_CURRENT | MCL_FUTURE) == 0);
+	pthread_getschedparam(pthread_self(), &rules->jit.policy,
+		&rules->jit.param);
+	param.sched_priority = sched_get_priority_min(SCHED_FIFO) + 1;
+	rules->jit.fifo = (pthread_setschedparam(pthread_self(), SCHED_FIFO,
+				&param) == 0);
+}
+
+void	jitter_thread(t_rules *rules)
+{
+	struct sched_param	param;
+
+	if (!rules->low_jitter)
+		return ;
+	prctl(PR_SET_TIMERSLACK, 1L, 0L, 0L, 0L);
+	if (!rules->jit.fifo)
+		return ;
+	param.sched_priority = sched_get_priority_min(SCHED_FIFO);
+	pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+}
+
+void	jitter_restore(t_rules *rules)
+{
+	if (!rules->low_jitter)
+		return ;
+	if (rules->jit.fifo)
+		pthread_setschedparam(pthread_self(), rules->jit.policy,
+			&rules->jit.param);
+	if (rules->jit.locked)
+		munlockall();
+	prctl(PR_SET_TIMERSLACK, 0L, 0L, 0L, 0L);
+}
+
+void	monitor_nap(t_rules *rules)
+{
+	long	begin;
+
+	begin = get_time_us();
+	usleep(1000);
+	hist_record(&rules->jit.wake, get_time_us() - begin - 1000);
+}
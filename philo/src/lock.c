@@ -0,0 +1,41 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lock.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:39:41 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 19:39:41 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+void	lock_mutex(t_rules *rules, pthread_mutex_t *mutex)
+{
+	(void)rules;
+	pthread_mutex_lock(mutex);
+}
+
+void	unlock_mutex(t_rules *rules, pthread_mutex_t *mutex)
+{
+	(void)rules;
+	pthread_mutex_unlock(mutex);
+}
+
+int	open_lockprof(t_rules *rules)
+{
+	rules->lockprof = NULL;
+	return (1);
+}
+
+void	close_lockprof(t_rules *rules)
+{
+	rules->lockprof = NULL;
+}
+
+void	print_lockprof(t_rules *rules)
+{
+	(void)rules;
+}
@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lockprof.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:39:41 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 19:39:41 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static long	now_ns(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000000000L + ts.tv_nsec);
+}
+
+static t_lockprof	*find_prof(t_rules *rules, pthread_mutex_t *mutex)
+{
+	long	offset;
+
+	if (mutex == &rules->stop_mutex)
+		return (&rules->lockprof[LOCK_STOP]);
+	if (mutex == &rules->print_mutex)
+		return (&rules->lockprof[LOCK_PRINT]);
+	if (mutex >= rules->forks && mutex < rules->forks + rules->num)
+		return (&rules->lockprof[LOCK_FORKS + (mutex - rules->forks)]);
+	offset = (char *)mutex - (char *)&rules->philos[0].meal_mutex;
+	return (&rules->lockprof[LOCK_FORKS + rules->num
+			+ offset / (long) sizeof(t_philo)]);
+}
+
+void	lock_mutex(t_rules *rules, pthread_mutex_t *mutex)
+{
+	t_lockprof	*prof;
+	long		start;
+	long		wait;
+
+	start = now_ns();
+	pthread_mutex_lock(mutex);
+	prof = find_prof(rules, mutex);
+	prof->since = now_ns();
+	wait = prof->since - start;
+	prof->count++;
+	prof->wait_ns += wait;
+	if (wait > prof->wait_max)
+		prof->wait_max = wait;
+}
+
+void	unlock_mutex(t_rules *rules, pthread_mutex_t *mutex)
+{
+	t_lockprof	*prof;
+	long		hold;
+
+	prof = find_prof(rules, mutex);
+	hold = now_ns() - prof->since;
+	prof->hold_ns += hold;
+	if (hold > prof->hold_max)
+		prof->hold_max = hold;
+	pthread_mutex_unlock(mutex);
+}
+
+int	open_lockprof(t_rules *rules)
+{
+	int	count;
+	int	idx;
+
+	count = LOCK_FORKS + 2 * rules->num;
+	rules->lockprof = malloc(sizeof(t_lockprof) * count);
+	if (!rules->lockprof)
+		return (0);
+	memset(rules->lockprof, 0, sizeof(t_lockprof) * count);
+	idx = 0;
+	while (idx < count)
+	{
+		rules->lockprof[idx].id = idx;
+		idx++;
+	}
+	return (1);
+}
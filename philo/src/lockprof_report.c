@@ -0,0 +1,87 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lockprof_report.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:39:41 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 19:39:41 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+void	close_lockprof(t_rules *rules)
+{
+	free(rules->lockprof);
+	rules->lockprof = NULL;
+}
+
+static void	sort_by_wait(t_lockprof *profs, int count)
+{
+	t_lockprof	key;
+	int			idx;
+	int			pos;
+
+	idx = 1;
+	while (idx < count)
+	{
+		key = profs[idx];
+		pos = idx - 1;
+		while (pos >= 0 && profs[pos].wait_ns < key.wait_ns)
+		{
+			profs[pos + 1] = profs[pos];
+			pos--;
+		}
+		profs[pos + 1] = key;
+		idx++;
+	}
+}
+
+static void	lock_name(t_rules *rules, int id, char *buf)
+{
+	if (id == LOCK_STOP)
+		snprintf(buf, 24, "stop");
+	else if (id == LOCK_PRINT)
+		snprintf(buf, 24, "print");
+	else if (id < LOCK_FORKS + rules->num)
+		snprintf(buf, 24, "fork[%d]", id - LOCK_FORKS + 1);
+	else
+		snprintf(buf, 24, "meal[%d]", id - LOCK_FORKS - rules->num + 1);
+}
+
+static void	print_prof(t_rules *rules, t_lockprof *prof)
+{
+	char	name[24];
+	long	avg;
+
+	lock_name(rules, prof->id, name);
+	avg = 0;
+	if (prof->count > 0)
+		avg = prof->wait_ns / prof->count;
+	fprintf(stderr, "%-10s %10ld %14ld %12ld %10ld %14ld %12ld\n", name,
+		prof->count, prof->wait_ns / 1000, prof->wait_max / 1000, avg,
+		prof->hold_ns / 1000, prof->hold_max / 1000);
+}
+
+void	print_lockprof(t_rules *rules)
+{
+	int	count;
+	int	idx;
+
+	if (!rules->lockprof)
+		return ;
+	count = LOCK_FORKS + 2 * rules->num;
+	sort_by_wait(rules->lockprof, count);
+	fprintf(stderr, "\nlock contention (sorted by total wait)\n");
+	fprintf(stderr, "%-10s %10s %14s %12s %10s %14s %12s\n", "lock",
+		"acquires", "wait_total_us", "wait_max_us", "wait_avg_ns",
+		"hold_total_us", "hold_max_us");
+	idx = 0;
+	while (idx < count)
+	{
+		print_prof(rules, &rules->lockprof[idx]);
+		idx++;
+	}
+}
@@ -6,34 +6,84 @@
 /*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/22 23:02:52 by eabdelfa          #+#    #+#             */
-/*   Updated: 2026/01/26 19:36:20 by eabdelfa         ###   ########.fr       */
+/*   Updated: 2026/10/18 21:07:09 by eabdelfa         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "philo.h"
 
+static void	print_event(void *ctx, t_philo_event *ev)
+{
+	char	line[128];
+
+	(void)ctx;
+	format_event(line, sizeof(line), ev);
+	if (ev->kind == PHILO_EV_LOW_SLACK)
+		fputs(line, stderr);
+	else
+		fputs(line, stdout);
+}
+
+static void	report_run(t_cli *cli, t_philo_sim *sim)
+{
+	if (philo_error(sim))
+		print_error(philo_error(sim));
+	if (cli->stats)
+		print_stats(sim);
+	if (cli->cfg.low_jitter)
+		print_jitter(sim);
+	print_lockprof(sim);
+	write_trace(sim, cli->trace_path);
+}
+
+static int	setup(t_cli *cli, int ac, char **av)
+{
+	memset(cli, 0, sizeof(t_cli));
+	philo_config_init(&cli->cfg);
+	ac = parse_options(cli, ac, av);
+	if (cli->stack_kb > 0)
+		cli->cfg.stack_size = cli->stack_kb * 1024;
+	if (cli->batch_path || cli->grid)
+		return (ac == 1);
+	if ((ac != 5 && ac != 6) || !parse_rules(&cli->cfg, ac, av))
+		return (0);
+	cli->cfg.on_event = print_event;
+	cli->cfg.record = (cli->trace_path != NULL);
+	return (1);
+}
+
+static int	run_tool(t_cli *cli)
+{
+	if (cli->grid)
+		return (run_grid(cli));
+	if (cli->batch_path)
+		return (run_batch(cli));
+	return (run_analyze(cli));
+}
+
 int	main(int ac, char **av)
 {
-	t_rules	rules;
+	t_cli		cli;
+	t_philo_sim	*sim;
 
-	if (ac != 5 && ac != 6)
+	if (!setup(&cli, ac, av))
 	{
 		print_usage();
 		return (1);
 	}
-	memset(&rules, 0, sizeof(t_rules));
-	if (!init_rules(&rules, ac, av))
+	if (cli.grid || cli.batch_path || cli.analyze)
+		return (run_tool(&cli));
+	sim = philo_create(&cli.cfg);
+	if (!sim)
+		return (error_exit("failed to allocate memory", 1));
+	if (philo_error(sim))
 	{
-		cleanup_rules(&rules);
-		print_usage();
+		print_error(philo_error(sim));
+		philo_destroy(sim);
 		return (1);
 	}
-	if (!init_philos(&rules))
-	{
-		cleanup_rules(&rules);
-		return (error_exit("philosopher initialization failed", 1));
-	}
-	start_simulation(&rules);
-	cleanup_rules(&rules);
+	philo_run(sim);
+	report_run(&cli, sim);
+	philo_destroy(sim);
 	return (0);
 }
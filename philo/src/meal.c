@@ -6,7 +6,7 @@
 /*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/23 12:00:00 by eabdelfa          #+#    #+#             */
-/*   Updated: 2026/01/23 17:02:44 by eabdelfa         ###   ########.fr       */
+/*   Updated: 2026/10/18 20:40:10 by eabdelfa         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,16 +14,19 @@
 
 void	update_meal_time(t_philo *philo, long now)
 {
-	pthread_mutex_lock(&philo->meal_mutex);
+	lock_mutex(philo->rules, &philo->meal_mutex);
 	philo->last_meal = now;
-	pthread_mutex_unlock(&philo->meal_mutex);
+	philo->eating = 1;
+	unlock_mutex(philo->rules, &philo->meal_mutex);
 }
 
 void	increment_meals(t_philo *philo)
 {
-	pthread_mutex_lock(&philo->meal_mutex);
+	lock_mutex(philo->rules, &philo->meal_mutex);
 	philo->meals++;
-	pthread_mutex_unlock(&philo->meal_mutex);
+	philo->eating = 0;
+	publish_meals(philo, philo->meals);
+	unlock_mutex(philo->rules, &philo->meal_mutex);
 }
 
 void	eat(t_philo *philo)
@@ -32,7 +35,11 @@ void	eat(t_philo *philo)
 
 	now = get_time_ms();
 	update_meal_time(philo, now);
-	print_state(philo, "is eating", 0);
-	ft_usleep(philo->rules, philo->rules->t_eat);
+	publish_meal(philo, now);
+	probe_state(philo->id, ST_EATING, philo->meals);
+	trace_mark(philo, ST_EATING);
+	note_meal(philo, get_time_us());
+	print_state(philo, ST_EATING, 0);
+	timed_usleep(philo, &philo->lat.eat, philo->rules->t_eat);
 	increment_meals(philo);
 }
@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   metrics.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:31:19 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 19:31:19 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static void	metrics_name(char *buf, int pid)
+{
+	char	digits[16];
+	int		len;
+	int		pos;
+
+	len = 0;
+	while (pid > 0 || len == 0)
+	{
+		digits[len] = '0' + pid % 10;
+		pid /= 10;
+		len++;
+	}
+	pos = ft_strlen(METRICS_PREFIX);
+	memcpy(buf, METRICS_PREFIX, pos);
+	while (len > 0)
+	{
+		len--;
+		buf[pos] = digits[len];
+		pos++;
+	}
+	buf[pos] = '\0';
+}
+
+static void	fill_page(t_rules *rules, t_mpage *page)
+{
+	page->magic = METRICS_MAGIC;
+	page->version = METRICS_VERSION;
+	page->num = rules->num;
+	page->pid = getpid();
+	page->slot_size = sizeof(t_mslot);
+	page->bonus = 0;
+	page->t_die = rules->t_die;
+	page->t_eat = rules->t_eat;
+	page->t_sleep = rules->t_sleep;
+	page->must_eat = -1;
+	if (rules->has_must)
+		page->must_eat = rules->must_eat;
+	atomic_store(&page->done, 0);
+}
+
+static int	map_page(t_rules *rules, int fd)
+{
+	void	*page;
+
+	if (ftruncate(fd, rules->msize) != 0)
+		return (0);
+	page = mmap(NULL, rules->msize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if (page == MAP_FAILED)
+		return (0);
+	rules->mpage = page;
+	fill_page(rules, rules->mpage);
+	return (1);
+}
+
+int	open_metrics(t_rules *rules)
+{
+	int	fd;
+	int	mapped;
+
+	metrics_name(rules->mname, getpid());
+	rules->msize = sizeof(t_mpage) + sizeof(t_mslot) * rules->num;
+	fd = shm_open(rules->mname, O_CREAT | O_EXCL | O_RDWR, 0644);
+	if (fd < 0)
+		return (0);
+	mapped = map_page(rules, fd);
+	close(fd);
+	if (!mapped)
+		shm_unlink(rules->mname);
+	return (mapped);
+}
+
+void	close_metrics(t_rules *rules)
+{
+	if (!rules->mpage)
+		return ;
+	atomic_store(&rules->mpage->done, 1);
+	munmap(rules->mpage, rules->msize);
+	shm_unlink(rules->mname);
+	rules->mpage = NULL;
+}
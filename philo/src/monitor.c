@@ -6,7 +6,7 @@
 /*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/22 23:03:10 by eabdelfa          #+#    #+#             */
-/*   Updated: 2026/02/02 23:01:03 by eabdelfa         ###   ########.fr       */
+/*   Updated: 2026/10/18 20:54:35 by eabdelfa         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -23,10 +23,10 @@ static int	all_ate_enough(t_rules *rules)
 	philo_idx = 0;
 	while (philo_idx < rules->num)
 	{
-		pthread_mutex_lock(&rules->philos[philo_idx].meal_mutex);
+		lock_mutex(rules, &rules->philos[philo_idx].meal_mutex);
 		if (rules->philos[philo_idx].meals >= rules->must_eat)
 			fed_philos++;
-		pthread_mutex_unlock(&rules->philos[philo_idx].meal_mutex);
+		unlock_mutex(rules, &rules->philos[philo_idx].meal_mutex);
 		philo_idx++;
 	}
 	if (fed_philos == rules->num)
@@ -34,6 +34,16 @@ static int	all_ate_enough(t_rules *rules)
 	return (0);
 }
 
+static int	declare_death(t_rules *rules, t_philo *philo)
+{
+	set_stop(rules);
+	publish_state(philo, ST_DEAD);
+	probe_state(philo->id, ST_DEAD, -1);
+	trace_death(philo);
+	print_state(philo, ST_DEAD, 1);
+	return (1);
+}
+
 static int	check_death(t_rules *rules)
 {
 	int		philo_idx;
@@ -43,21 +53,18 @@ static int	check_death(t_rules *rules)
 	philo_idx = 0;
 	while (philo_idx < rules->num)
 	{
-		pthread_mutex_lock(&rules->philos[philo_idx].meal_mutex);
+		lock_mutex(rules, &rules->philos[philo_idx].meal_mutex);
 		last_meal_time = rules->philos[philo_idx].last_meal;
-		pthread_mutex_unlock(&rules->philos[philo_idx].meal_mutex);
+		unlock_mutex(rules, &rules->philos[philo_idx].meal_mutex);
 		if (last_meal_time < 0)
 		{
 			philo_idx++;
 			continue ;
 		}
 		current_time = get_time_ms();
+		sum_sample(rules, philo_idx, current_time - last_meal_time);
 		if (current_time - last_meal_time > rules->t_die)
-		{
-			set_stop(rules);
-			print_state(&rules->philos[philo_idx], "died", 1);
-			return (1);
-		}
+			return (declare_death(rules, &rules->philos[philo_idx]));
 		philo_idx++;
 	}
 	return (0);
@@ -79,6 +86,7 @@ void	monitor_simulation(t_rules *rules)
 			set_stop(rules);
 			return ;
 		}
-		usleep(1000);
+		sum_tick(rules, 0);
+		monitor_nap(rules);
 	}
 }
@@ -6,7 +6,7 @@
 /*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/23 12:00:00 by eabdelfa          #+#    #+#             */
-/*   Updated: 2026/01/23 17:02:44 by eabdelfa         ###   ########.fr       */
+/*   Updated: 2026/10/18 20:32:46 by eabdelfa         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -21,7 +21,7 @@ static int	init_fork_mutexes(t_rules *rules)
 	{
 		if (pthread_mutex_init(&rules->forks[philo_idx], NULL) != 0)
 		{
-			print_error("failed to initialize fork mutex");
+			set_error(rules, "failed to initialize fork mutex");
 			return (0);
 		}
 		rules->forks_init++;
@@ -34,13 +34,13 @@ int	init_mutexes(t_rules *rules)
 {
 	if (pthread_mutex_init(&rules->stop_mutex, NULL) != 0)
 	{
-		print_error("failed to initialize stop mutex");
+		set_error(rules, "failed to initialize stop mutex");
 		return (0);
 	}
 	rules->stop_init = 1;
 	if (pthread_mutex_init(&rules->print_mutex, NULL) != 0)
 	{
-		print_error("failed to initialize print mutex");
+		set_error(rules, "failed to initialize print mutex");
 		return (0);
 	}
 	rules->print_init = 1;
@@ -0,0 +1,100 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   options.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:41:39 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 21:07:09 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static char	*opt_value(char *arg, char *name)
+{
+	size_t	len;
+
+	len = ft_strlen(name);
+	if (ft_strncmp(arg, name, len) != 0)
+		return (NULL);
+	return (arg + len);
+}
+
+static int	parse_ms(char *value, long *dst)
+{
+	if (!is_positive_number(value))
+		return (0);
+	*dst = ft_atol(value);
+	return (*dst != LONG_MAX);
+}
+
+static int	set_number(t_cli *cli, char *arg)
+{
+	if (opt_value(arg, "--warn-slack="))
+		return (parse_ms(opt_value(arg, "--warn-slack="),
+				&cli->cfg.warn_slack));
+	if (opt_value(arg, "--margin="))
+		return (parse_ms(opt_value(arg, "--margin="), &cli->cfg.margin));
+	if (opt_value(arg, "--summary="))
+		return (parse_ms(opt_value(arg, "--summary="), &cli->cfg.summary));
+	if (opt_value(arg, "--max-philos="))
+		return (parse_ms(opt_value(arg, "--max-philos="), &cli->cfg.max_num));
+	if (opt_value(arg, "--stack="))
+		return (parse_ms(opt_value(arg, "--stack="), &cli->stack_kb));
+	if (opt_value(arg, "--jobs="))
+		return (parse_ms(opt_value(arg, "--jobs="), &cli->jobs)
+			&& cli->jobs > 0);
+	return (0);
+}
+
+static int	set_option(t_cli *cli, char *arg)
+{
+	if (ft_strncmp(arg, "--stats", 8) == 0)
+		cli->stats = 1;
+	else if (ft_strncmp(arg, "--metrics", 10) == 0)
+		cli->cfg.metrics = 1;
+	else if (ft_strncmp(arg, "--low-jitter", 13) == 0)
+		cli->cfg.low_jitter = 1;
+	else if (opt_value(arg, "--trace="))
+		cli->trace_path = opt_value(arg, "--trace=");
+	else if (opt_value(arg, "--batch="))
+		cli->batch_path = opt_value(arg, "--batch=");
+	else if (opt_value(arg, "--batch-logs="))
+		cli->batch_logs = opt_value(arg, "--batch-logs=");
+	else if (ft_strncmp(arg, "--analyze", 10) == 0)
+		cli->analyze = 1;
+	else if (opt_value(arg, "--grid="))
+		cli->grid = opt_value(arg, "--grid=");
+	else
+		return (set_number(cli, arg));
+	return (1);
+}
+
+int	parse_options(t_cli *cli, int ac, char **av)
+{
+	int	src;
+	int	dst;
+
+	src = 1;
+	dst = 1;
+	while (src < ac)
+	{
+		if (av[src][0] == '-' && av[src][1] == '-')
+		{
+			if (!set_option(cli, av[src]))
+			{
+				print_error("unknown or invalid option");
+				return (-1);
+			}
+		}
+		else
+		{
+			av[dst] = av[src];
+			dst++;
+		}
+		src++;
+	}
+	return (dst);
+}
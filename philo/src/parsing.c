@@ -6,7 +6,7 @@
 /*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/26 00:00:00 by eabdelfa          #+#    #+#             */
-/*   Updated: 2026/01/31 16:48:37 by eabdelfa         ###   ########.fr       */
+/*   Updated: 2026/10/18 20:50:20 by eabdelfa         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -23,7 +23,7 @@ static int	validate_args(char **av)
 	return (1);
 }
 
-static int	parse_and_set_timings(t_rules *rules, char **av)
+static int	parse_and_set_timings(t_philo_config *cfg, char **av)
 {
 	long	num_philos;
 	long	time_to_die;
@@ -36,19 +36,21 @@ static int	parse_and_set_timings(t_rules *rules, char **av)
 	time_to_sleep = ft_atol(av[4]);
 	if (num_philos == LONG_MAX || time_to_die == LONG_MAX
 		|| time_to_eat == LONG_MAX || time_to_sleep == LONG_MAX
-		|| num_philos > INT_MAX || num_philos > 200 || num_philos < 1)
+		|| num_philos > INT_MAX || num_philos > cfg->max_num
+		|| num_philos < 1)
 	{
-		print_error("number of philosophers must be between 1 and 200");
+		fprintf(stderr, "Error: number of philosophers must be between 1 "
+			"and %ld\n", cfg->max_num);
 		return (0);
 	}
-	rules->num = (int)num_philos;
-	rules->t_die = time_to_die;
-	rules->t_eat = time_to_eat;
-	rules->t_sleep = time_to_sleep;
+	cfg->num = (int)num_philos;
+	cfg->t_die = time_to_die;
+	cfg->t_eat = time_to_eat;
+	cfg->t_sleep = time_to_sleep;
 	return (1);
 }
 
-static int	parse_must_eat(t_rules *rules, int ac, char **av)
+static int	parse_must_eat(t_philo_config *cfg, int ac, char **av)
 {
 	long	must_eat_count;
 
@@ -65,19 +67,18 @@ static int	parse_must_eat(t_rules *rules, int ac, char **av)
 			print_error("number must be within valid range");
 			return (0);
 		}
-		rules->must_eat = (int)must_eat_count;
-		rules->has_must = 1;
+		cfg->must_eat = (int)must_eat_count;
 	}
 	return (1);
 }
 
-int	parse_rules(t_rules *rules, int ac, char **av)
+int	parse_rules(t_philo_config *cfg, int ac, char **av)
 {
 	if (!validate_args(av))
 		return (0);
-	if (!parse_and_set_timings(rules, av))
+	if (!parse_and_set_timings(cfg, av))
 		return (0);
-	if (!parse_must_eat(rules, ac, av))
+	if (!parse_must_eat(cfg, ac, av))
 		return (0);
 	return (1);
 }
@@ -6,7 +6,7 @@
 /*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/23 12:00:00 by eabdelfa          #+#    #+#             */
-/*   Updated: 2026/01/23 17:02:44 by eabdelfa         ###   ########.fr       */
+/*   Updated: 2026/10/18 20:32:46 by eabdelfa         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -25,14 +25,16 @@ int	init_philos(t_rules *rules)
 	philo_idx = 0;
 	while (philo_idx < rules->num)
 	{
+		memset(&rules->philos[philo_idx], 0, sizeof(t_philo));
 		rules->philos[philo_idx].id = philo_idx + 1;
-		rules->philos[philo_idx].meals = 0;
 		rules->philos[philo_idx].last_meal = -1;
+		rules->philos[philo_idx].slot = slot_offset(rules, philo_idx + 1);
+		rules->philos[philo_idx].think.min_budget = rules->t_die;
 		rules->philos[philo_idx].rules = rules;
 		setup_philo_forks(rules, philo_idx);
 		if (pthread_mutex_init(&rules->philos[philo_idx].meal_mutex, NULL) != 0)
 		{
-			print_error("failed to initialize philosopher meal mutex");
+			set_error(rules, "failed to initialize philosopher meal mutex");
 			while (--philo_idx >= 0)
 				pthread_mutex_destroy(&rules->philos[philo_idx].meal_mutex);
 			return (0);
@@ -6,23 +6,34 @@
 /*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/23 12:00:00 by eabdelfa          #+#    #+#             */
-/*   Updated: 2026/01/23 17:02:44 by eabdelfa         ###   ########.fr       */
+/*   Updated: 2026/10/18 20:40:10 by eabdelfa         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "philo.h"
 
-void	print_state(t_philo *philo, char *msg, int force)
+void	emit_event(t_rules *rules, t_philo_event *ev)
 {
-	long	time;
+	lock_mutex(rules, &rules->print_mutex);
+	rules->on_event(rules->event_ctx, ev);
+	unlock_mutex(rules, &rules->print_mutex);
+}
+
+void	print_state(t_philo *philo, int state, int force)
+{
+	t_philo_event	ev;
 
-	pthread_mutex_lock(&philo->rules->stop_mutex);
+	if (!philo->rules->on_event || (philo->rules->summary && !force))
+		return ;
+	lock_mutex(philo->rules, &philo->rules->stop_mutex);
 	if (!philo->rules->stop || force)
 	{
-		time = get_time_ms() - philo->rules->start;
-		pthread_mutex_lock(&philo->rules->print_mutex);
-		printf("%ld %d %s\n", time, philo->id, msg);
-		pthread_mutex_unlock(&philo->rules->print_mutex);
+		ev.ts = get_time_ms() - philo->rules->start;
+		ev.id = philo->id;
+		ev.kind = state;
+		ev.arg = 0;
+		ev.summary = NULL;
+		emit_event(philo->rules, &ev);
 	}
-	pthread_mutex_unlock(&philo->rules->stop_mutex);
+	unlock_mutex(philo->rules, &philo->rules->stop_mutex);
 }
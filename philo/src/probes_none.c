@@ -0,0 +1,38 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   probes_none.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:46:39 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 19:46:39 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+void	probe_fork(int id, int fork, int taken)
+{
+	(void)id;
+	(void)fork;
+	(void)taken;
+}
+
+void	probe_release(int id)
+{
+	(void)id;
+}
+
+void	probe_state(int id, int state, long arg)
+{
+	(void)id;
+	(void)state;
+	(void)arg;
+}
+
+void	probe_sim(t_rules *rules, int running)
+{
+	(void)rules;
+	(void)running;
+}
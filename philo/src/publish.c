@@ -0,0 +1,59 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   publish.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:31:19 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 19:31:19 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+void	publish_start(t_rules *rules)
+{
+	int	idx;
+
+	if (!rules->mpage)
+		return ;
+	idx = 0;
+	while (idx < rules->num)
+	{
+		atomic_store(&rules->mpage->slots[idx].last_meal, rules->start);
+		atomic_store(&rules->mpage->slots[idx].deadline,
+			rules->start + rules->t_die);
+		idx++;
+	}
+	atomic_store(&rules->mpage->start, rules->start);
+}
+
+void	publish_state(t_philo *philo, int state)
+{
+	if (!philo->rules->mpage)
+		return ;
+	atomic_store_explicit(&philo->rules->mpage->slots[philo->id - 1].state,
+		state, memory_order_release);
+}
+
+void	publish_meal(t_philo *philo, long now)
+{
+	t_mslot	*slot;
+
+	if (!philo->rules->mpage)
+		return ;
+	slot = &philo->rules->mpage->slots[philo->id - 1];
+	atomic_store_explicit(&slot->last_meal, now, memory_order_relaxed);
+	atomic_store_explicit(&slot->deadline, now + philo->rules->t_die,
+		memory_order_relaxed);
+	atomic_store_explicit(&slot->state, ST_EATING, memory_order_release);
+}
+
+void	publish_meals(t_philo *philo, int meals)
+{
+	if (!philo->rules->mpage)
+		return ;
+	atomic_store_explicit(&philo->rules->mpage->slots[philo->id - 1].meals,
+		meals, memory_order_release);
+}
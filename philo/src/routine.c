@@ -6,7 +6,7 @@
 /*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/22 23:03:25 by eabdelfa          #+#    #+#             */
-/*   Updated: 2026/01/23 17:02:44 by eabdelfa         ###   ########.fr       */
+/*   Updated: 2026/10/18 20:54:35 by eabdelfa         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,30 +14,31 @@
 
 static void	philo_sleep(t_philo *philo)
 {
-	print_state(philo, "is sleeping", 0);
-	ft_usleep(philo->rules, philo->rules->t_sleep);
+	publish_state(philo, ST_SLEEPING);
+	probe_state(philo->id, ST_SLEEPING, 0);
+	trace_mark(philo, ST_SLEEPING);
+	print_state(philo, ST_SLEEPING, 0);
+	timed_usleep(philo, &philo->lat.sleep, philo->rules->t_sleep);
 }
 
 static void	philo_think(t_philo *philo)
 {
-	long	think_time;
-
-	print_state(philo, "is thinking", 0);
-	if (philo->rules->num % 2 == 1)
-	{
-		think_time = philo->rules->t_die - (philo->rules->t_eat
-				+ philo->rules->t_sleep);
-		if (think_time > 0)
-			ft_usleep(philo->rules, think_time / 2);
-	}
+	publish_state(philo, ST_THINKING);
+	probe_state(philo->id, ST_THINKING, 0);
+	trace_mark(philo, ST_THINKING);
+	print_state(philo, ST_THINKING, 0);
+	adaptive_think(philo);
 }
 
 static void	solo_philo(t_philo *philo)
 {
-	pthread_mutex_lock(philo->left);
-	print_state(philo, "has taken a fork", 0);
+	probe_fork(philo->id, 1, 0);
+	lock_mutex(philo->rules, philo->left);
+	probe_fork(philo->id, 1, 1);
+	publish_state(philo, ST_FORK);
+	print_state(philo, ST_FORK, 0);
 	ft_usleep(philo->rules, philo->rules->t_die);
-	pthread_mutex_unlock(philo->left);
+	unlock_mutex(philo->rules, philo->left);
 }
 
 void	*philo_routine(void *arg)
@@ -45,13 +46,14 @@ void	*philo_routine(void *arg)
 	t_philo	*philo;
 
 	philo = (t_philo *)arg;
+	jitter_thread(philo->rules);
 	if (philo->rules->num == 1)
 	{
 		solo_philo(philo);
 		return (NULL);
 	}
-	if (philo->id % 2 == 0)
-		usleep(1000);
+	ft_usleep(philo->rules, philo->slot
+		- (get_time_ms() - philo->rules->start));
 	while (!get_stop(philo->rules))
 	{
 		take_forks(philo);
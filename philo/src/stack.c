@@ -0,0 +1,102 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stack.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 20:41:32 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 20:41:32 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+int	open_stacks(t_rules *rules)
+{
+	long	page;
+	void	*map;
+	int		idx;
+
+	page = sysconf(_SC_PAGESIZE);
+	rules->stack_size = (rules->stack_size + page - 1) / page * page;
+	rules->stack_stride = rules->stack_size + page;
+	map = mmap(NULL, rules->stack_stride * rules->num, PROT_READ | PROT_WRITE,
+			MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_STACK, -1, 0);
+	if (map == MAP_FAILED)
+		return (0);
+	rules->stacks = map;
+	idx = 0;
+	while (idx < rules->num)
+	{
+		if (mprotect(rules->stacks + idx * rules->stack_stride, page,
+				PROT_NONE) != 0)
+			return (0);
+		idx++;
+	}
+	return (1);
+}
+
+void	close_stacks(t_rules *rules)
+{
+	if (rules->stacks)
+		munmap(rules->stacks, rules->stack_stride * rules->num);
+	rules->stacks = NULL;
+}
+
+static long	count_resident(t_rules *rules, int idx, unsigned char *vec)
+{
+	long	pages;
+	long	page;
+	long	count;
+	char	*base;
+
+	page = rules->stack_stride - rules->stack_size;
+	pages = rules->stack_size / page;
+	base = rules->stacks + idx * rules->stack_stride + page;
+	if (mincore(base, rules->stack_size, vec) != 0)
+		return (0);
+	count = 0;
+	while (pages-- > 0)
+		count += (vec[pages] & 1);
+	return (count * page);
+}
+
+static long	heap_per_philo(t_rules *rules)
+{
+	long	bytes;
+
+	bytes = sizeof(t_philo) + sizeof(pthread_mutex_t);
+	if (rules->trace)
+		bytes += sizeof(t_tbuf);
+	if (rules->mpage)
+		bytes += sizeof(t_mslot);
+	if (rules->lockprof)
+		bytes += sizeof(t_lockprof);
+	return (bytes);
+}
+
+void	measure_stacks(t_rules *rules)
+{
+	unsigned char	*vec;
+	long			touched;
+	long			total;
+	int				idx;
+
+	rules->mem.stack_reserved = rules->stack_stride;
+	rules->mem.heap = heap_per_philo(rules);
+	vec = malloc(rules->stack_size / (rules->stack_stride
+				- rules->stack_size));
+	total = 0;
+	idx = 0;
+	while (vec && rules->stacks && idx < rules->num)
+	{
+		touched = count_resident(rules, idx++, vec);
+		total += touched;
+		if (touched > rules->mem.stack_touched_max)
+			rules->mem.stack_touched_max = touched;
+	}
+	free(vec);
+	rules->mem.stack_touched_avg = total / rules->num;
+	rules->mem.per_philo = rules->mem.heap + rules->mem.stack_touched_avg;
+}
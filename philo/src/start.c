@@ -6,12 +6,30 @@
 /*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/22 23:03:34 by eabdelfa          #+#    #+#             */
-/*   Updated: 2026/02/02 23:19:09 by eabdelfa         ###   ########.fr       */
+/*   Updated: 2026/10/18 20:54:35 by eabdelfa         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "philo.h"
 
+int	spawn_philo(t_rules *rules, int idx)
+{
+	pthread_attr_t	attr;
+	char			*stack;
+	int				ret;
+
+	stack = rules->stacks + idx * rules->stack_stride
+		+ (rules->stack_stride - rules->stack_size);
+	if (pthread_attr_init(&attr) != 0)
+		return (0);
+	ret = pthread_attr_setstack(&attr, stack, rules->stack_size);
+	if (ret == 0)
+		ret = pthread_create(&rules->philos[idx].thread, &attr,
+				&philo_routine, &rules->philos[idx]);
+	pthread_attr_destroy(&attr);
+	return (ret == 0);
+}
+
 static int	create_threads(t_rules *rules)
 {
 	int	philo_idx;
@@ -19,13 +37,12 @@ static int	create_threads(t_rules *rules)
 	philo_idx = 0;
 	while (philo_idx < rules->num)
 	{
-		pthread_mutex_lock(&rules->philos[philo_idx].meal_mutex);
+		lock_mutex(rules, &rules->philos[philo_idx].meal_mutex);
 		rules->philos[philo_idx].last_meal = rules->start;
-		pthread_mutex_unlock(&rules->philos[philo_idx].meal_mutex);
-		if (pthread_create(&rules->philos[philo_idx].thread, NULL,
-				&philo_routine, &rules->philos[philo_idx]) != 0)
+		unlock_mutex(rules, &rules->philos[philo_idx].meal_mutex);
+		if (!spawn_philo(rules, philo_idx))
 		{
-			print_error("failed to create philosopher thread");
+			set_error(rules, "failed to create philosopher thread");
 			return (philo_idx);
 		}
 		philo_idx++;
@@ -45,6 +62,15 @@ static void	join_threads(t_rules *rules, int count)
 	}
 }
 
+static int	abort_start(t_rules *rules, int created)
+{
+	set_error(rules, "failed to create all philosopher threads");
+	set_stop(rules);
+	join_threads(rules, created);
+	jitter_restore(rules);
+	return (1);
+}
+
 int	start_simulation(t_rules *rules)
 {
 	int	threads_created;
@@ -54,16 +80,19 @@ int	start_simulation(t_rules *rules)
 		set_stop(rules);
 		return (0);
 	}
+	jitter_setup(rules);
 	rules->start = get_time_ms();
+	publish_start(rules);
+	probe_sim(rules, 1);
 	threads_created = create_threads(rules);
 	if (threads_created != rules->num)
-	{
-		print_error("failed to create all philosopher threads");
-		set_stop(rules);
-		join_threads(rules, threads_created);
-		return (1);
-	}
+		return (abort_start(rules, threads_created));
 	monitor_simulation(rules);
+	rules->end = get_time_ms();
+	sum_tick(rules, 1);
+	probe_sim(rules, 0);
 	join_threads(rules, rules->num);
+	jitter_restore(rules);
+	measure_stacks(rules);
 	return (0);
 }
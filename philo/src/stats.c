@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stats.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:41:52 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 20:54:35 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static void	print_philo_stats(t_philo *philo, int last)
+{
+	t_think	*think;
+	long	avg;
+	char	*sep;
+
+	think = &philo->think;
+	avg = 0;
+	if (think->decisions > 0)
+		avg = think->total / think->decisions;
+	sep = ",";
+	if (last)
+		sep = "";
+	fprintf(stderr, "      {\"id\": %d, \"slot_ms\": %ld, \"meals\": %d, "
+		"\"decisions\": %ld, "
+		"\"think_ms_total\": %ld, \"think_ms_avg\": %ld, \"capped\": %ld, "
+		"\"min_budget_ms\": %ld, \"fork_wait_ewma_ms\": %ld}%s\n",
+		philo->id, philo->slot, philo->meals, think->decisions, think->total,
+		avg, think->capped, think->min_budget, think->wait_est >> 4, sep);
+}
+
+static void	print_memory(t_rules *rules)
+{
+	t_philo_memory	*mem;
+
+	mem = &rules->mem;
+	fprintf(stderr, "  \"memory\": {\"stack_reserved\": %ld, "
+		"\"stack_touched_max\": %ld, \"stack_touched_avg\": %ld, "
+		"\"heap_per_philo\": %ld, \"bytes_per_philo\": %ld},\n",
+		mem->stack_reserved, mem->stack_touched_max, mem->stack_touched_avg,
+		mem->heap, mem->per_philo);
+}
+
+static void	print_jitter_json(t_rules *rules)
+{
+	fprintf(stderr, "  \"jitter\": {\"low_jitter\": %d, "
+		"\"timer_slack_1ns\": %d, \"mlockall\": %d, \"sched_fifo\": %d, ",
+		rules->low_jitter, rules->jit.slack, rules->jit.locked,
+		rules->jit.fifo);
+	print_hist("monitor_wake_us", &rules->jit.wake, "},\n");
+}
+
+void	print_jitter(t_rules *rules)
+{
+	static char	*slack[] = {"default", "1 ns"};
+	static char	*mem[] = {"pre-faulted", "locked"};
+	static char	*sched[] = {"SCHED_OTHER", "SCHED_FIFO"};
+	t_lat		total;
+	int			idx;
+
+	memset(&total, 0, sizeof(t_lat));
+	idx = 0;
+	while (idx < rules->num)
+		lat_merge(&total, &rules->philos[idx++].lat);
+	fprintf(stderr, "low-jitter: timer slack %s, memory %s, %s\n",
+		slack[rules->jit.slack], mem[rules->jit.locked],
+		sched[rules->jit.fifo]);
+	fprintf(stderr, "low-jitter: monitor wakeup late p50 %ld us, p99 %ld us, "
+		"max %ld us; sleep overshoot p99 %ld us, max %ld us\n",
+		hist_quantile(&rules->jit.wake, 5000),
+		hist_quantile(&rules->jit.wake, 9900), rules->jit.wake.max,
+		hist_quantile(&total.sleep, 9900), total.sleep.max);
+}
+
+void	print_stats(t_rules *rules)
+{
+	int	idx;
+
+	fprintf(stderr, "{\n  \"schedule\": {\"phases\": %d, "
+		"\"period_ms\": %ld},\n", rules->phases, rules->period);
+	fprintf(stderr, "  \"think_controller\": {\n"
+		"    \"margin_ms\": %ld,\n    \"philos\": [\n", rules->margin);
+	idx = 0;
+	while (idx < rules->num)
+	{
+		print_philo_stats(&rules->philos[idx], idx == rules->num - 1);
+		idx++;
+	}
+	fprintf(stderr, "    ]\n  },\n");
+	print_memory(rules);
+	print_jitter_json(rules);
+	print_latency(rules);
+	fprintf(stderr, "}\n");
+}
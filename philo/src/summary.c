@@ -0,0 +1,88 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   summary.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 20:34:13 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 20:34:13 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+void	sum_sample(t_rules *rules, int idx, long age)
+{
+	if (!rules->summary || age <= rules->sum.worst_age)
+		return ;
+	rules->sum.worst_age = age;
+	rules->sum.worst_id = idx + 1;
+}
+
+static void	count_table(t_rules *rules, t_philo_summary *out)
+{
+	t_philo	*philo;
+	int		idx;
+
+	out->total = 0;
+	out->eating = 0;
+	idx = 0;
+	while (idx < rules->num)
+	{
+		philo = &rules->philos[idx];
+		lock_mutex(rules, &philo->meal_mutex);
+		out->total += philo->meals;
+		out->eating += philo->eating;
+		unlock_mutex(rules, &philo->meal_mutex);
+		idx++;
+	}
+}
+
+static void	take_summary(t_rules *rules, long now)
+{
+	t_sum	*sum;
+
+	sum = &rules->sum;
+	count_table(rules, &sum->snap);
+	sum->snap.meals = sum->snap.total - sum->total;
+	sum->snap.min_slack = rules->t_die - sum->worst_age;
+	sum->snap.slack_id = sum->worst_id;
+	sum->pending = now;
+}
+
+static void	emit_summary(t_rules *rules, long ts)
+{
+	t_philo_event	ev;
+
+	ev.ts = ts - rules->start;
+	ev.id = 0;
+	ev.kind = PHILO_EV_SUMMARY;
+	ev.arg = rules->summary;
+	ev.summary = &rules->sum.snap;
+	emit_event(rules, &ev);
+	rules->sum.total = rules->sum.snap.total;
+	rules->sum.worst_age = 0;
+	rules->sum.pending = 0;
+}
+
+void	sum_tick(t_rules *rules, int final)
+{
+	t_sum	*sum;
+	long	now;
+
+	if (!rules->summary || !rules->on_event)
+		return ;
+	sum = &rules->sum;
+	now = get_time_ms();
+	if (sum->next == 0)
+		sum->next = rules->start + rules->summary;
+	if (sum->pending && now > sum->pending)
+		emit_summary(rules, sum->pending);
+	if (final || (now >= sum->next && !sum->pending))
+		take_summary(rules, now);
+	if (final)
+		emit_summary(rules, now);
+	while (sum->next <= now)
+		sum->next += rules->summary;
+}
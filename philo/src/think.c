@@ -0,0 +1,86 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   think.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:41:51 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 19:42:28 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static long	neighbor_hint(t_philo *philo, t_philo *other, long now)
+{
+	long	their_meal;
+
+	lock_mutex(other->rules, &other->meal_mutex);
+	their_meal = other->last_meal;
+	unlock_mutex(other->rules, &other->meal_mutex);
+	if (now - their_meal < philo->rules->t_eat)
+		return (their_meal + philo->rules->t_eat - now);
+	if (their_meal < philo->last_meal)
+		return (1);
+	return (0);
+}
+
+static long	think_hint(t_philo *philo, long now)
+{
+	t_rules	*rules;
+	long	left;
+	long	right;
+	long	hint;
+
+	rules = philo->rules;
+	left = neighbor_hint(philo,
+			&rules->philos[(philo->id + rules->num - 2) % rules->num], now);
+	right = neighbor_hint(philo, &rules->philos[philo->id % rules->num], now);
+	hint = slot_wait(philo, now);
+	if (left > hint)
+		hint = left;
+	if (right > hint)
+		hint = right;
+	return (hint);
+}
+
+static long	think_budget(t_philo *philo, long now)
+{
+	return (philo->rules->t_die - philo->rules->margin
+		- (now - philo->last_meal) - (philo->think.wait_est >> 4));
+}
+
+void	record_fork_wait(t_philo *philo, long wait)
+{
+	philo->think.wait_est += ((wait << 4) - philo->think.wait_est) >> 2;
+}
+
+void	adaptive_think(t_philo *philo)
+{
+	long	start;
+	long	now;
+	long	budget;
+	long	hint;
+
+	start = get_time_ms();
+	now = start;
+	budget = think_budget(philo, now);
+	if (budget < philo->think.min_budget)
+		philo->think.min_budget = budget;
+	while (!get_stop(philo->rules))
+	{
+		budget = think_budget(philo, now);
+		hint = think_hint(philo, now);
+		if (hint > 0 && budget <= 0)
+			philo->think.capped++;
+		if (hint <= 0 || budget <= 0)
+			break ;
+		if (hint > budget)
+			hint = budget;
+		ft_usleep(philo->rules, hint);
+		now = get_time_ms();
+	}
+	philo->think.decisions++;
+	philo->think.total += now - start;
+}
@@ -0,0 +1,53 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:50:58 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 20:32:46 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+int	open_trace(t_rules *rules)
+{
+	if (!rules->record)
+		return (1);
+	rules->trace = malloc(sizeof(t_tbuf) * rules->num);
+	if (!rules->trace)
+		return (0);
+	memset(rules->trace, 0, sizeof(t_tbuf) * rules->num);
+	return (1);
+}
+
+void	close_trace(t_rules *rules)
+{
+	free(rules->trace);
+	rules->trace = NULL;
+}
+
+void	trace_mark(t_philo *philo, int state)
+{
+	t_tbuf	*buf;
+
+	if (!philo->rules->trace)
+		return ;
+	buf = &philo->rules->trace[philo->id - 1];
+	if (buf->count == TRACE_CAP)
+	{
+		buf->dropped++;
+		return ;
+	}
+	buf->ev[buf->count].ts = get_time_us() - philo->rules->start * 1000;
+	buf->ev[buf->count].state = state;
+	buf->count++;
+}
+
+void	trace_death(t_philo *philo)
+{
+	philo->rules->death_id = philo->id;
+	philo->rules->death_us = get_time_us() - philo->rules->start * 1000;
+}
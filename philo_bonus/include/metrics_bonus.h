@@ -0,0 +1,55 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   metrics_bonus.h                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:32:06 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 19:32:06 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef METRICS_BONUS_H
+# define METRICS_BONUS_H
+
+# include <stdatomic.h>
+
+# define METRICS_MAGIC 0x4f4c4850
+# define METRICS_VERSION 1
+# define METRICS_PREFIX "/philo."
+# define METRICS_NAME_MAX 32
+
+# define ST_IDLE 0
+# define ST_FORK 1
+# define ST_EATING 2
+# define ST_SLEEPING 3
+# define ST_THINKING 4
+# define ST_DEAD 5
+
+typedef struct s_mslot
+{
+	_Alignas(64) atomic_long	last_meal;
+	atomic_long					deadline;
+	atomic_int					meals;
+	atomic_int					state;
+}								t_mslot;
+
+typedef struct s_mpage
+{
+	unsigned int				magic;
+	unsigned int				version;
+	int							num;
+	int							pid;
+	int							slot_size;
+	int							bonus;
+	long						t_die;
+	long						t_eat;
+	long						t_sleep;
+	long						must_eat;
+	atomic_long					start;
+	atomic_int					done;
+	t_mslot						slots[];
+}								t_mpage;
+
+#endif
@@ -6,34 +6,151 @@
 /*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/22 23:04:39 by eabdelfa          #+#    #+#             */
-/*   Updated: 2026/01/31 16:57:50 by eabdelfa         ###   ########.fr       */
+/*   Updated: 2026/10/18 20:40:10 by eabdelfa         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #ifndef PHILO_BONUS_H
 # define PHILO_BONUS_H
 
+# include <errno.h>
 # include <fcntl.h>
 # include <limits.h>
+# include <linux/futex.h>
 # include <pthread.h>
 # include <semaphore.h>
 # include <signal.h>
+# include <stdatomic.h>
 # include <stdio.h>
 # include <stdlib.h>
 # include <string.h>
+# include <sys/epoll.h>
+# include <sys/mman.h>
+# include <sys/pidfd.h>
+# include <sys/prctl.h>
+# include <sys/syscall.h>
 # include <sys/time.h>
 # include <sys/wait.h>
+# include <time.h>
 # include <unistd.h>
+# include "metrics_bonus.h"
+
+# define DEFAULT_MARGIN 10
+# define HIST_SUB_BITS 4
+# define HIST_SUB 16
+# define HIST_BUCKETS 512
+# define BACKSTOP_MS 5
+# define STOP_TIMEOUT_MS 100
+# define FORKS_POOL 0
+# define FORKS_SEATS 1
+# define BENCH_SIZES 3
+# define BENCH_RUNS 5
+# define FANOUT 32
+# define GATE_CHECK_MS 1000
+# define TRACE_CAP 8192
 
 typedef struct s_rules	t_rules;
 
+typedef struct s_think
+{
+	long				wait_est;
+	long				decisions;
+	long				total;
+	long				capped;
+	long				min_budget;
+}						t_think;
+
+typedef struct s_hist
+{
+	long				count;
+	long				sum;
+	long				min;
+	long				max;
+	long				below;
+	unsigned int		bins[HIST_BUCKETS];
+}						t_hist;
+
+typedef struct s_lat
+{
+	t_hist				fork_wait;
+	t_hist				eat;
+	t_hist				sleep;
+	t_hist				meal_gap;
+	t_hist				slack;
+	long				min_slack;
+	long				warnings;
+	long				last_meal_us;
+}						t_lat;
+
+typedef struct s_tev
+{
+	long				ts;
+	int					state;
+}						t_tev;
+
+typedef struct s_tbuf
+{
+	long				count;
+	long				dropped;
+	t_tev				ev[TRACE_CAP];
+}						t_tbuf;
+
+typedef struct s_slot
+{
+	atomic_long			last_meal;
+	atomic_int			meals;
+	atomic_int			eating;
+	atomic_long			max_gap;
+	pid_t				pid;
+	t_think				think;
+	t_lat				lat;
+}						t_slot;
+
+typedef struct s_shared
+{
+	sem_t				forks;
+	sem_t				print;
+	sem_t				ready;
+	sem_t				gate;
+	sem_t				seats;
+	atomic_long			start;
+	atomic_int			dead;
+	atomic_int			stop;
+	atomic_long			death_late_us;
+	atomic_long			death_us;
+	atomic_long			free_us;
+	t_slot				slots[];
+}						t_shared;
+
+typedef struct s_sum
+{
+	long				next;
+	long				total;
+	long				seen;
+	int					eating;
+	long				worst;
+	int					worst_id;
+	long				pending;
+}						t_sum;
+
+typedef struct s_bench
+{
+	int					num;
+	long				fork_us;
+	long				ready_us;
+	long				worst_us;
+}						t_bench;
+
 typedef struct s_philo
 {
 	int					id;
 	int					meals;
 	long				last_meal;
-	pthread_t			monitor;
-	pthread_mutex_t		meal_mutex;
+	long				meal_us;
+	long				slot;
+	int					held;
+	int					seated;
+	t_slot				*shared;
 	t_rules				*rules;
 }						t_philo;
 
@@ -46,36 +163,115 @@ struct					s_rules
 	int					must_eat;
 	int					has_must;
 	long				start;
+	long				end;
+	long				margin;
+	long				period;
+	int					phases;
+	int					stats;
+	long				summary;
+	t_sum				sum;
+	long				warn_slack;
+	int					metrics;
+	char				mname[METRICS_NAME_MAX];
+	size_t				msize;
+	t_mpage				*mpage;
+	char				*trace_path;
+	t_tbuf				*trace;
+	int					startup_bench;
+	int					fork_mode;
 	sem_t				*forks;
 	sem_t				*print;
-	char				*forks_name;
-	char				*print_name;
+	sem_t				*seats;
+	int					sems_init;
 	pid_t				*pids;
+	int					*pidfds;
+	int					epfd;
+	int					live;
+	pid_t				pgid;
+	pid_t				parent;
+	int					end_reason;
+	long				teardown_us;
+	int					killed;
+	t_shared			*shared;
+	size_t				shared_size;
+	t_slot				*slots;
 };
 
+int						parse_options(t_rules *rules, int ac, char **av);
 int						init_rules(t_rules *rules, int ac, char **av);
 int						parse_rules(t_rules *rules, int ac, char **av);
+int						open_table(t_rules *rules);
 int						open_sems(t_rules *rules);
+int						open_shared(t_rules *rules);
+void					reset_slots(t_rules *rules);
 int						start_simulation(t_rules *rules);
+int						fork_children(t_rules *rules);
+int						spawn_children(t_rules *rules);
+void					reap_children(t_rules *rules);
+int						open_supervisor(t_rules *rules);
+void					close_supervisor(t_rules *rules);
+int						watch_child(t_rules *rules, int idx, pid_t pid);
+int						wait_children(t_rules *rules, int timeout_ms);
+void					wait_ready(t_rules *rules);
+void					open_gate(t_rules *rules);
+void					pass_gate(t_rules *rules);
+int						startup_bench(t_rules *rules);
 void					cleanup_rules(t_rules *rules);
 
 void					child_process(t_rules *rules, int id);
-void					*monitor_routine(void *arg);
+int						monitor_children(t_rules *rules);
+void					summary_tick(t_rules *rules, int *wait_ms, int final);
 void					take_forks(t_philo *philo);
 void					release_forks(t_philo *philo);
 void					eat(t_philo *philo);
 void					update_meal_time(t_philo *philo, long now);
 void					increment_meals(t_philo *philo);
+void					build_schedule(t_rules *rules);
+long					slot_offset(t_rules *rules, int id);
+long					slot_wait(t_philo *philo, long now);
+void					adaptive_think(t_philo *philo);
+long					deadline_us(t_rules *rules, long meal_us);
+void					report_death(t_philo *philo);
+void					wait_until(t_philo *philo, long end);
+void					timed_wait(t_philo *philo, sem_t *sem);
+void					raise_stop(t_rules *rules);
+void					release_waiters(t_rules *rules);
+void					leave_table(t_philo *philo);
+void					sleep_until(t_philo *philo, long when_us);
+void					record_fork_wait(t_philo *philo, long wait);
+void					print_stats(t_rules *rules);
+int						open_metrics(t_rules *rules);
+int						open_trace(t_rules *rules);
+void					close_trace(t_rules *rules);
+void					trace_mark(t_philo *philo, int state);
+void					trace_death(t_rules *rules);
+int						write_trace(t_rules *rules);
+void					probe_fork(int id, int fork, int taken);
+void					probe_release(int id);
+void					probe_state(int id, int state, long arg);
+void					probe_sim(t_rules *rules, int running);
+void					close_metrics(t_rules *rules);
+void					publish_start(t_rules *rules);
+void					publish_state(t_philo *philo, int state);
+void					publish_meal(t_philo *philo, long now);
+void					publish_meals(t_philo *philo, int meals);
+void					publish_dead(t_rules *rules, int idx);
+void					print_latency(t_rules *rules);
+void					hist_record(t_hist *hist, long value);
+void					hist_merge(t_hist *dst, t_hist *src);
+long					hist_quantile(t_hist *hist, long q);
+void					timed_usleep(t_philo *philo, t_hist *hist, long begin,
+							long ms);
+void					note_meal(t_philo *philo, long now_us);
+void					lat_merge(t_lat *dst, t_lat *src);
 
 long					get_time_ms(void);
-void					ft_usleep(long ms);
+long					get_time_us(void);
 
 int						is_positive_number(char *s);
 long					ft_atol(char *s);
 size_t					ft_strlen(char *s);
-char					*ft_strdup(char *s);
-char					*ft_strjoin(char *s1, char *s2);
-char					*ft_itoa(int n);
+int						ft_strncmp(char *s1, char *s2, size_t n);
 
 void					print_state(t_philo *philo, char *msg);
 
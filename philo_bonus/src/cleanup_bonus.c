@@ -6,7 +6,7 @@
 /*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/22 23:03:56 by eabdelfa          #+#    #+#             */
-/*   Updated: 2026/01/23 17:02:44 by eabdelfa         ###   ########.fr       */
+/*   Updated: 2026/10/18 19:54:08 by eabdelfa         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,20 +14,25 @@
 
 void	cleanup_rules(t_rules *rules)
 {
-	if (rules->forks && rules->forks != SEM_FAILED)
-		sem_close(rules->forks);
-	if (rules->print && rules->print != SEM_FAILED)
-		sem_close(rules->print);
-	if (rules->forks_name)
-	{
-		sem_unlink(rules->forks_name);
-		free(rules->forks_name);
-	}
-	if (rules->print_name)
-	{
-		sem_unlink(rules->print_name);
-		free(rules->print_name);
-	}
+	if (rules->sems_init > 0)
+		sem_destroy(rules->forks);
+	if (rules->sems_init > 1)
+		sem_destroy(rules->print);
+	if (rules->sems_init > 2)
+		sem_destroy(&rules->shared->ready);
+	if (rules->sems_init > 3)
+		sem_destroy(&rules->shared->gate);
+	if (rules->sems_init > 4)
+		sem_destroy(rules->seats);
+	rules->sems_init = 0;
+	close_metrics(rules);
+	close_trace(rules);
+	close_supervisor(rules);
 	if (rules->pids)
 		free(rules->pids);
+	rules->pids = NULL;
+	if (rules->shared)
+		munmap(rules->shared, rules->shared_size);
+	rules->shared = NULL;
+	rules->slots = NULL;
 }
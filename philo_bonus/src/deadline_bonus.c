@@ -0,0 +1,88 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   deadline_bonus.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:45:04 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 19:54:08 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_bonus.h"
+
+long	deadline_us(t_rules *rules, long meal_us)
+{
+	return ((meal_us / 1000 + rules->t_die + 1) * 1000);
+}
+
+void	report_death(t_philo *philo)
+{
+	t_rules	*rules;
+	int		expected;
+	long	late;
+
+	rules = philo->rules;
+	late = get_time_us() - (philo->meal_us + rules->t_die * 1000);
+	expected = 0;
+	if (atomic_compare_exchange_strong(&rules->shared->dead, &expected,
+			philo->id))
+	{
+		publish_state(philo, ST_DEAD);
+		probe_state(philo->id, ST_DEAD, late);
+		trace_death(rules);
+		sem_wait(rules->print);
+		atomic_store(&rules->shared->death_late_us, late);
+		printf("%ld %d died\n", get_time_ms() - rules->start, philo->id);
+		raise_stop(rules);
+		sem_post(rules->print);
+	}
+	leave_table(philo);
+}
+
+void	wait_until(t_philo *philo, long end)
+{
+	long	deadline;
+
+	if (end <= get_time_us())
+		return ;
+	deadline = deadline_us(philo->rules, philo->meal_us);
+	if (deadline <= end)
+	{
+		sleep_until(philo, deadline);
+		report_death(philo);
+	}
+	sleep_until(philo, end);
+}
+
+static int	posted_in_time(t_philo *philo, sem_t *sem, long deadline)
+{
+	if (sem_trywait(sem) != 0)
+		return (0);
+	if (atomic_load(&philo->rules->shared->free_us) <= deadline)
+		return (1);
+	sem_post(sem);
+	return (0);
+}
+
+void	timed_wait(t_philo *philo, sem_t *sem)
+{
+	struct timespec	ts;
+	long			deadline;
+	int				err;
+
+	deadline = deadline_us(philo->rules, philo->meal_us);
+	ts.tv_sec = deadline / 1000000;
+	ts.tv_nsec = (deadline % 1000000) * 1000;
+	while (sem_timedwait(sem, &ts) != 0)
+	{
+		err = errno;
+		if (atomic_load(&philo->rules->shared->stop))
+			leave_table(philo);
+		if (err != EINTR && !posted_in_time(philo, sem, deadline))
+			report_death(philo);
+		if (err != EINTR)
+			return ;
+	}
+}
@@ -6,7 +6,7 @@
 /*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/23 12:00:00 by eabdelfa          #+#    #+#             */
-/*   Updated: 2026/01/23 17:02:44 by eabdelfa         ###   ########.fr       */
+/*   Updated: 2026/10/18 20:40:10 by eabdelfa         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -19,14 +19,32 @@ void	print_error(char *msg)
 	write(2, "\n", 1);
 }
 
+static void	print_options(void)
+{
+	write(2, "\nOptions:\n", 10);
+	write(2, "  --margin=MS      safety margin kept before T_DIE (10)\n", 56);
+	write(2, "  --forks=MODE     seats (N/2 seats, default) or pool\n", 54);
+	write(2, "  --metrics        publish live metrics under /dev/shm\n", 55);
+	write(2, "  --warn-slack=MS  warn when a meal starts with less"
+		" slack\n", 59);
+	write(2, "  --trace=FILE     write a Chrome trace-event timeline at"
+		" exit\n", 63);
+	write(2, "  --stats          print run statistics as JSON on stderr\n", 58);
+	write(2, "  --summary=MS     print one aggregate line every MS instead of"
+		" events\n", 71);
+	write(2, "  --startup-bench  time child startup (N = 50, 200, 1000)\n", 58);
+}
+
 void	print_usage(void)
 {
-	write(2, "Usage: ./philo_bonus N T_DIE T_EAT T_SLEEP [T_EAT_COUNT]\n", 57);
+	write(2, "Usage: ./philo_bonus [OPTIONS] N T_DIE T_EAT T_SLEEP"
+		" [T_EAT_COUNT]\n", 67);
 	write(2, "\n  N:              number of philosophers (1-200)\n", 50);
 	write(2, "  T_DIE:          time to die in milliseconds (> 60)\n", 53);
 	write(2, "  T_EAT:          time to eat in milliseconds (> 60)\n", 53);
 	write(2, "  T_SLEEP:        time to sleep in milliseconds (> 60)\n", 55);
 	write(2, "  T_EAT_COUNT:    (optional) meals per philosopher\n", 51);
+	print_options();
 }
 
 int	error_exit(char *msg, int code)
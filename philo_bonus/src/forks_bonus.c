@@ -6,22 +6,51 @@
 /*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/23 12:00:00 by eabdelfa          #+#    #+#             */
-/*   Updated: 2026/01/23 17:02:44 by eabdelfa         ###   ########.fr       */
+/*   Updated: 2026/10/18 19:54:08 by eabdelfa         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "philo_bonus.h"
 
-void	take_forks(t_philo *philo)
+static void	grab_fork(t_philo *philo, int nth)
 {
-	sem_wait(philo->rules->forks);
-	print_state(philo, "has taken a fork");
-	sem_wait(philo->rules->forks);
+	probe_fork(philo->id, nth, 0);
+	timed_wait(philo, philo->rules->forks);
+	philo->held++;
+	if (nth == 2)
+		philo->meal_us = get_time_us();
+	probe_fork(philo->id, nth, 1);
+	if (nth == 1)
+		publish_state(philo, ST_FORK);
 	print_state(philo, "has taken a fork");
 }
 
+void	take_forks(t_philo *philo)
+{
+	long	start;
+
+	trace_mark(philo, ST_FORK);
+	start = get_time_us();
+	if (philo->rules->fork_mode == FORKS_SEATS)
+	{
+		timed_wait(philo, philo->rules->seats);
+		philo->seated = 1;
+	}
+	grab_fork(philo, 1);
+	grab_fork(philo, 2);
+	start = philo->meal_us - start;
+	hist_record(&philo->shared->lat.fork_wait, start);
+	record_fork_wait(philo, (start + 500) / 1000);
+}
+
 void	release_forks(t_philo *philo)
 {
+	atomic_store(&philo->rules->shared->free_us, get_time_us());
 	sem_post(philo->rules->forks);
 	sem_post(philo->rules->forks);
+	philo->held = 0;
+	if (philo->seated)
+		sem_post(philo->rules->seats);
+	philo->seated = 0;
+	probe_release(philo->id);
 }
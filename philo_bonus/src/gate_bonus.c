@@ -0,0 +1,68 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gate_bonus.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:17:24 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 19:50:20 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_bonus.h"
+
+static void	gate_deadline(struct timespec *ts, long when_us)
+{
+	ts->tv_sec = when_us / 1000000;
+	ts->tv_nsec = (when_us % 1000000) * 1000;
+}
+
+void	pass_gate(t_rules *rules)
+{
+	struct timespec	ts;
+	long			until;
+
+	sem_post(&rules->shared->ready);
+	until = get_time_us() + GATE_CHECK_MS * 1000;
+	gate_deadline(&ts, until);
+	while (sem_timedwait(&rules->shared->gate, &ts) != 0)
+	{
+		if (kill(rules->parent, 0) != 0)
+			exit(1);
+		until += GATE_CHECK_MS * 1000;
+		gate_deadline(&ts, until);
+	}
+	rules->start = atomic_load(&rules->shared->start);
+}
+
+void	wait_ready(t_rules *rules)
+{
+	int	idx;
+
+	idx = 0;
+	while (idx < rules->num)
+	{
+		sem_wait(&rules->shared->ready);
+		idx++;
+	}
+}
+
+void	open_gate(t_rules *rules)
+{
+	int	idx;
+
+	rules->start = get_time_ms();
+	reset_slots(rules);
+	atomic_store(&rules->shared->dead, 0);
+	atomic_store(&rules->shared->stop, 0);
+	atomic_store(&rules->shared->start, rules->start);
+	publish_start(rules);
+	probe_sim(rules, 1);
+	idx = 0;
+	while (idx < rules->num)
+	{
+		sem_post(&rules->shared->gate);
+		idx++;
+	}
+}
@@ -6,26 +6,39 @@
 /*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/22 23:04:04 by eabdelfa          #+#    #+#             */
-/*   Updated: 2026/01/23 17:02:44 by eabdelfa         ###   ########.fr       */
+/*   Updated: 2026/10/18 19:54:08 by eabdelfa         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "philo_bonus.h"
 
-int	init_rules(t_rules *rules, int ac, char **av)
+int	open_table(t_rules *rules)
 {
-	if (!parse_rules(rules, ac, av))
-		return (0);
 	rules->pids = malloc(sizeof(pid_t) * rules->num);
 	if (!rules->pids)
 	{
 		print_error("memory allocation failed for process IDs");
 		return (0);
 	}
-	if (!open_sems(rules))
+	memset(rules->pids, 0, sizeof(pid_t) * rules->num);
+	return (open_supervisor(rules) && open_shared(rules) && open_sems(rules));
+}
+
+int	init_rules(t_rules *rules, int ac, char **av)
+{
+	if (!parse_rules(rules, ac, av))
+		return (0);
+	build_schedule(rules);
+	if (!open_table(rules))
+		return (0);
+	if (!open_trace(rules))
+	{
+		print_error("failed to allocate trace buffers");
+		return (0);
+	}
+	if (rules->metrics && !open_metrics(rules))
 	{
-		free(rules->pids);
-		rules->pids = NULL;
+		print_error("failed to publish metrics page");
 		return (0);
 	}
 	return (1);
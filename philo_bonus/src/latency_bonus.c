@@ -0,0 +1,70 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   latency_bonus.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:10:28 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 19:45:51 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_bonus.h"
+
+void	timed_usleep(t_philo *philo, t_hist *hist, long begin, long ms)
+{
+	wait_until(philo, begin + ms * 1000);
+	hist_record(hist, get_time_us() - begin - ms * 1000);
+}
+
+static void	warn_slack(t_philo *philo, long slack)
+{
+	t_lat	*lat;
+
+	lat = &philo->shared->lat;
+	lat->warnings++;
+	fprintf(stderr, "%ld %d low slack %ld us\n",
+		get_time_ms() - philo->rules->start, philo->id, slack);
+}
+
+static void	record_slack(t_philo *philo, t_lat *lat, long now_us)
+{
+	long	prev;
+	long	slack;
+
+	prev = lat->last_meal_us;
+	if (prev == 0)
+		prev = philo->rules->start * 1000;
+	slack = philo->rules->t_die * 1000 - (now_us - prev);
+	if (lat->slack.count == 0 || slack < lat->min_slack)
+		lat->min_slack = slack;
+	hist_record(&lat->slack, slack);
+	if (philo->rules->warn_slack > 0
+		&& slack < philo->rules->warn_slack * 1000)
+		warn_slack(philo, slack);
+}
+
+void	note_meal(t_philo *philo, long now_us)
+{
+	t_lat	*lat;
+
+	lat = &philo->shared->lat;
+	record_slack(philo, lat, now_us);
+	if (lat->last_meal_us > 0)
+		hist_record(&lat->meal_gap, now_us - lat->last_meal_us);
+	lat->last_meal_us = now_us;
+}
+
+void	lat_merge(t_lat *dst, t_lat *src)
+{
+	hist_merge(&dst->fork_wait, &src->fork_wait);
+	hist_merge(&dst->eat, &src->eat);
+	hist_merge(&dst->sleep, &src->sleep);
+	hist_merge(&dst->meal_gap, &src->meal_gap);
+	if (src->slack.count > 0
+		&& (dst->slack.count == 0 || src->min_slack < dst->min_slack))
+		dst->min_slack = src->min_slack;
+	hist_merge(&dst->slack, &src->slack);
+	dst->warnings += src->warnings;
+}
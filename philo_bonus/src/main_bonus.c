@@ -6,7 +6,7 @@
 /*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/22 23:04:12 by eabdelfa          #+#    #+#             */
-/*   Updated: 2026/01/23 17:02:44 by eabdelfa         ###   ########.fr       */
+/*   Updated: 2026/10/18 19:54:08 by eabdelfa         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,12 +16,15 @@ int	main(int ac, char **av)
 {
 	t_rules	rules;
 
+	memset(&rules, 0, sizeof(t_rules));
+	ac = parse_options(&rules, ac, av);
+	if (ac == 1 && rules.startup_bench)
+		return (startup_bench(&rules));
 	if (ac != 5 && ac != 6)
 	{
 		print_usage();
 		return (1);
 	}
-	memset(&rules, 0, sizeof(t_rules));
 	if (!init_rules(&rules, ac, av))
 	{
 		cleanup_rules(&rules);
@@ -29,6 +32,8 @@ int	main(int ac, char **av)
 		return (1);
 	}
 	start_simulation(&rules);
+	print_stats(&rules);
+	write_trace(&rules);
 	cleanup_rules(&rules);
 	return (0);
 }
@@ -6,7 +6,7 @@
 /*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/23 12:00:00 by eabdelfa          #+#    #+#             */
-/*   Updated: 2026/01/23 17:02:44 by eabdelfa         ###   ########.fr       */
+/*   Updated: 2026/10/18 20:40:10 by eabdelfa         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,25 +14,32 @@
 
 void	update_meal_time(t_philo *philo, long now)
 {
-	pthread_mutex_lock(&philo->meal_mutex);
+	if (now - philo->last_meal > atomic_load(&philo->shared->max_gap))
+		atomic_store(&philo->shared->max_gap, now - philo->last_meal);
 	philo->last_meal = now;
-	pthread_mutex_unlock(&philo->meal_mutex);
+	atomic_store(&philo->shared->last_meal, now);
+	atomic_store(&philo->shared->eating, 1);
+	publish_meal(philo, now);
 }
 
 void	increment_meals(t_philo *philo)
 {
-	pthread_mutex_lock(&philo->meal_mutex);
 	philo->meals++;
-	pthread_mutex_unlock(&philo->meal_mutex);
+	atomic_store(&philo->shared->meals, philo->meals);
+	atomic_store(&philo->shared->eating, 0);
+	publish_meals(philo, philo->meals);
 }
 
 void	eat(t_philo *philo)
 {
 	long	now;
 
-	now = get_time_ms();
-	update_meal_time(philo, now);
+	now = philo->meal_us;
+	update_meal_time(philo, now / 1000);
+	note_meal(philo, now);
+	probe_state(philo->id, ST_EATING, philo->meals);
+	trace_mark(philo, ST_EATING);
 	print_state(philo, "is eating");
-	ft_usleep(philo->rules->t_eat);
+	timed_usleep(philo, &philo->shared->lat.eat, now, philo->rules->t_eat);
 	increment_meals(philo);
 }
@@ -6,53 +6,95 @@
 /*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/22 23:04:33 by eabdelfa          #+#    #+#             */
-/*   Updated: 2026/01/23 17:02:44 by eabdelfa         ###   ########.fr       */
+/*   Updated: 2026/10/18 20:40:10 by eabdelfa         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "philo_bonus.h"
 
-static long	get_last_meal_time(t_philo *philo)
+static int	is_fed(t_rules *rules, int idx)
 {
-	long	last_meal_time;
+	return (rules->has_must
+		&& atomic_load(&rules->slots[idx].meals) >= rules->must_eat);
+}
+
+static int	claim_death(t_rules *rules, int idx, long now)
+{
+	int		expected;
+	long	last_meal;
 
-	pthread_mutex_lock(&philo->meal_mutex);
-	last_meal_time = philo->last_meal;
-	pthread_mutex_unlock(&philo->meal_mutex);
-	return (last_meal_time);
+	expected = 0;
+	if (!atomic_compare_exchange_strong(&rules->shared->dead, &expected,
+			idx + 1))
+		return (0);
+	publish_dead(rules, idx);
+	probe_state(idx + 1, ST_DEAD, -1);
+	trace_death(rules);
+	sem_wait(rules->print);
+	last_meal = atomic_load(&rules->slots[idx].last_meal);
+	atomic_store(&rules->shared->death_late_us,
+		get_time_us() - (last_meal + rules->t_die) * 1000);
+	printf("%ld %d died\n", now - rules->start, idx + 1);
+	raise_stop(rules);
+	sem_post(rules->print);
+	return (1);
 }
 
-static void	check_philo_death(t_philo *philo, long current_time)
+static int	check_death(t_rules *rules, int *wait_ms)
 {
-	if (current_time - philo->last_meal > philo->rules->t_die)
+	int		idx;
+	long	now;
+	long	left;
+
+	*wait_ms = rules->t_die + BACKSTOP_MS;
+	now = get_time_ms();
+	idx = 0;
+	while (idx < rules->num)
 	{
-		sem_wait(philo->rules->print);
-		printf("%ld %d died\n", current_time - philo->rules->start, philo->id);
-		exit(1);
+		left = atomic_load(&rules->slots[idx].last_meal) + rules->t_die
+			+ BACKSTOP_MS - now;
+		if (!is_fed(rules, idx) && left < 0 && claim_death(rules, idx, now))
+			return (1);
+		if (!is_fed(rules, idx) && left < *wait_ms)
+			*wait_ms = left + 1;
+		idx++;
 	}
+	if (*wait_ms < 1)
+		*wait_ms = 1;
+	return (0);
+}
+
+static int	all_fed(t_rules *rules)
+{
+	int	idx;
+
+	if (!rules->has_must)
+		return (0);
+	idx = 0;
+	while (idx < rules->num && is_fed(rules, idx))
+		idx++;
+	return (idx == rules->num);
 }
 
-void	*monitor_routine(void *arg)
+int	monitor_children(t_rules *rules)
 {
-	t_philo	*philo;
-	long	current_time;
-	long	last_meal_time;
+	int	wait_ms;
 
-	philo = (t_philo *)arg;
 	while (1)
 	{
-		last_meal_time = get_last_meal_time(philo);
-		if (last_meal_time < 0)
-		{
-			usleep(1000);
-			continue ;
-		}
-		current_time = get_time_ms();
-		if (current_time - last_meal_time > philo->rules->t_die)
+		if (atomic_load(&rules->shared->dead))
+			return (1);
+		if (check_death(rules, &wait_ms))
+			return (1);
+		if (all_fed(rules))
+			return (2);
+		summary_tick(rules, &wait_ms, 0);
+		if (wait_children(rules, wait_ms))
 		{
-			check_philo_death(philo, current_time);
+			if (atomic_load(&rules->shared->dead))
+				return (1);
+			return (3);
 		}
-		usleep(1000);
 	}
-	return (NULL);
+	return (0);
 }
@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   options_bonus.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:45:15 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 20:40:10 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_bonus.h"
+
+static char	*opt_value(char *arg, char *name)
+{
+	size_t	len;
+
+	len = ft_strlen(name);
+	if (ft_strncmp(arg, name, len) != 0)
+		return (NULL);
+	return (arg + len);
+}
+
+static int	parse_ms(char *value, long *dst)
+{
+	if (!is_positive_number(value))
+		return (0);
+	*dst = ft_atol(value);
+	return (*dst != LONG_MAX);
+}
+
+static int	set_option(t_rules *rules, char *arg)
+{
+	if (ft_strncmp(arg, "--stats", 8) == 0)
+		rules->stats = 1;
+	else if (ft_strncmp(arg, "--metrics", 10) == 0)
+		rules->metrics = 1;
+	else if (ft_strncmp(arg, "--startup-bench", 16) == 0)
+		rules->startup_bench = 1;
+	else if (ft_strncmp(arg, "--forks=pool", 13) == 0)
+		rules->fork_mode = FORKS_POOL;
+	else if (ft_strncmp(arg, "--forks=seats", 14) == 0)
+		rules->fork_mode = FORKS_SEATS;
+	else if (opt_value(arg, "--warn-slack="))
+		return (parse_ms(opt_value(arg, "--warn-slack="), &rules->warn_slack));
+	else if (opt_value(arg, "--trace="))
+		rules->trace_path = opt_value(arg, "--trace=");
+	else if (opt_value(arg, "--margin="))
+		return (parse_ms(opt_value(arg, "--margin="), &rules->margin));
+	else if (opt_value(arg, "--summary="))
+		return (parse_ms(opt_value(arg, "--summary="), &rules->summary));
+	else
+		return (0);
+	return (1);
+}
+
+int	parse_options(t_rules *rules, int ac, char **av)
+{
+	int	src;
+	int	dst;
+
+	rules->margin = DEFAULT_MARGIN;
+	rules->fork_mode = FORKS_SEATS;
+	src = 1;
+	dst = 1;
+	while (src < ac)
+	{
+		if (av[src][0] == '-' && av[src][1] == '-')
+		{
+			if (!set_option(rules, av[src]))
+			{
+				print_error("unknown or invalid option");
+				return (-1);
+			}
+		}
+		else
+		{
+			av[dst] = av[src];
+			dst++;
+		}
+		src++;
+	}
+	return (dst);
+}
@@ -6,7 +6,7 @@
 /*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/23 12:00:00 by eabdelfa          #+#    #+#             */
-/*   Updated: 2026/01/23 17:02:44 by eabdelfa         ###   ########.fr       */
+/*   Updated: 2026/10/18 20:40:10 by eabdelfa         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,7 +16,18 @@ void	print_state(t_philo *philo, char *msg)
 {
 	long	time;
 
+	if (philo->rules->summary)
+	{
+		if (atomic_load(&philo->rules->shared->stop))
+			leave_table(philo);
+		return ;
+	}
 	sem_wait(philo->rules->print);
+	if (atomic_load(&philo->rules->shared->stop))
+	{
+		sem_post(philo->rules->print);
+		leave_table(philo);
+	}
 	time = get_time_ms() - philo->rules->start;
 	printf("%ld %d %s\n", time, philo->id, msg);
 	sem_post(philo->rules->print);
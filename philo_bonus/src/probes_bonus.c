@@ -0,0 +1,47 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   probes_bonus.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:47:15 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 19:47:15 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_bonus.h"
+#include <sys/sdt.h>
+
+void	probe_fork(int id, int fork, int taken)
+{
+	if (taken)
+		DTRACE_PROBE2(philo, fork_taken, id, fork);
+	else
+		DTRACE_PROBE2(philo, fork_wait, id, fork);
+}
+
+void	probe_release(int id)
+{
+	DTRACE_PROBE1(philo, release, id);
+}
+
+void	probe_state(int id, int state, long arg)
+{
+	if (state == ST_EATING)
+		DTRACE_PROBE2(philo, eat, id, arg);
+	else if (state == ST_SLEEPING)
+		DTRACE_PROBE1(philo, sleep, id);
+	else if (state == ST_THINKING)
+		DTRACE_PROBE1(philo, think, id);
+	else if (state == ST_DEAD)
+		DTRACE_PROBE2(philo, death, id, arg);
+}
+
+void	probe_sim(t_rules *rules, int running)
+{
+	if (running)
+		DTRACE_PROBE2(philo, sim_start, rules->num, rules->start);
+	else
+		DTRACE_PROBE2(philo, sim_stop, rules->num, rules->end);
+}
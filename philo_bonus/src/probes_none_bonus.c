@@ -1,49 +1,38 @@
 /* ************************************************************************** */
 /*                                                                            */
 /*                                                        :::      ::::::::   */
-/*   number_utils_bonus.c                               :+:      :+:    :+:   */
+/*   probes_none_bonus.c                                :+:      :+:    :+:   */
 /*                                                    +:+ +:+         +:+     */
 /*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
-/*   Created: 2026/01/23 12:00:00 by eabdelfa          #+#    #+#             */
-/*   Updated: 2026/01/23 17:02:44 by eabdelfa         ###   ########.fr       */
+/*   Created: 2026/10/18 19:47:15 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 19:47:15 by eabdelfa         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "philo_bonus.h"
 
-static int	count_digits(int n)
+void	probe_fork(int id, int fork, int taken)
 {
-	int	count;
+	(void)id;
+	(void)fork;
+	(void)taken;
+}
 
-	count = 1;
-	while (n >= 10)
-	{
-		n /= 10;
-		count++;
-	}
-	return (count);
+void	probe_release(int id)
+{
+	(void)id;
 }
 
-char	*ft_itoa(int n)
+void	probe_state(int id, int state, long arg)
 {
-	char	*res;
-	int		len;
-	int		idx;
+	(void)id;
+	(void)state;
+	(void)arg;
+}
 
-	if (n < 0)
-		return (NULL);
-	len = count_digits(n);
-	res = malloc(len + 1);
-	if (!res)
-		return (NULL);
-	res[len] = '\0';
-	idx = len - 1;
-	while (idx >= 0)
-	{
-		res[idx] = (n % 10) + '0';
-		n /= 10;
-		idx--;
-	}
-	return (res);
+void	probe_sim(t_rules *rules, int running)
+{
+	(void)rules;
+	(void)running;
 }
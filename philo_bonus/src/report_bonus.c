@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   report_bonus.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:10:28 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 19:45:51 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_bonus.h"
+
+static void	print_hist(char *name, t_hist *hist, char *sep)
+{
+	long	mean;
+
+	mean = 0;
+	if (hist->count > 0)
+		mean = hist->sum / hist->count;
+	fprintf(stderr, "\"%s\": {\"count\": %ld, \"mean\": %ld, \"min\": %ld, "
+		"\"p50\": %ld, \"p90\": %ld, \"p99\": %ld, \"p999\": %ld, "
+		"\"max\": %ld, \"below\": %ld}%s", name, hist->count, mean,
+		hist->min, hist_quantile(hist, 5000), hist_quantile(hist, 9000),
+		hist_quantile(hist, 9900), hist_quantile(hist, 9990), hist->max,
+		hist->below, sep);
+}
+
+static void	print_lat(t_lat *lat)
+{
+	print_hist("fork_wait_us", &lat->fork_wait, ", ");
+	print_hist("eat_overshoot_us", &lat->eat, ", ");
+	print_hist("sleep_overshoot_us", &lat->sleep, ", ");
+	print_hist("meal_gap_us", &lat->meal_gap, ", ");
+	print_hist("slack_us", &lat->slack, ", ");
+	fprintf(stderr, "\"min_slack_us\": %ld, \"slack_warnings\": %ld",
+		lat->min_slack, lat->warnings);
+}
+
+static void	print_throughput(t_rules *rules)
+{
+	long	meals;
+	double	squares;
+	double	secs;
+	double	fairness;
+	int		idx;
+
+	meals = 0;
+	squares = 0;
+	idx = 0;
+	while (idx < rules->num)
+	{
+		meals += atomic_load(&rules->slots[idx].meals);
+		squares += (double)atomic_load(&rules->slots[idx].meals)
+			* atomic_load(&rules->slots[idx].meals);
+		idx++;
+	}
+	secs = (rules->end - rules->start) / 1000.0;
+	fairness = 1.0;
+	if (squares > 0)
+		fairness = (double)meals * meals / (rules->num * squares);
+	if (secs <= 0)
+		secs = 1.0;
+	fprintf(stderr, "  \"throughput\": {\"duration_ms\": %ld, \"meals\": %ld, "
+		"\"meals_per_s\": %.2f, \"jain_fairness\": %.4f},\n",
+		rules->end - rules->start, meals, meals / secs, fairness);
+}
+
+static void	print_philo_lats(t_rules *rules)
+{
+	int	idx;
+
+	idx = 0;
+	while (idx < rules->num)
+	{
+		fprintf(stderr, "      {\"id\": %d, ", idx + 1);
+		print_lat(&rules->slots[idx].lat);
+		if (idx == rules->num - 1)
+			fprintf(stderr, "}\n");
+		else
+			fprintf(stderr, "},\n");
+		idx++;
+	}
+}
+
+void	print_latency(t_rules *rules)
+{
+	t_lat	total;
+	int		idx;
+
+	memset(&total, 0, sizeof(t_lat));
+	idx = 0;
+	while (idx < rules->num)
+	{
+		lat_merge(&total, &rules->slots[idx].lat);
+		idx++;
+	}
+	print_throughput(rules);
+	fprintf(stderr, "  \"latency\": {\n    \"overall\": {");
+	print_lat(&total);
+	fprintf(stderr, "},\n    \"philos\": [\n");
+	print_philo_lats(rules);
+	fprintf(stderr, "    ]\n  }\n");
+}
@@ -6,7 +6,7 @@
 /*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/22 23:04:44 by eabdelfa          #+#    #+#             */
-/*   Updated: 2026/02/02 23:09:45 by eabdelfa         ###   ########.fr       */
+/*   Updated: 2026/10/18 19:54:08 by eabdelfa         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,62 +14,51 @@
 
 static void	philo_sleep(t_philo *philo)
 {
+	long	begin;
+
+	begin = get_time_us();
+	publish_state(philo, ST_SLEEPING);
+	probe_state(philo->id, ST_SLEEPING, 0);
+	trace_mark(philo, ST_SLEEPING);
 	print_state(philo, "is sleeping");
-	ft_usleep(philo->rules->t_sleep);
+	timed_usleep(philo, &philo->shared->lat.sleep, begin,
+		philo->rules->t_sleep);
 }
 
 static void	philo_think(t_philo *philo)
 {
-	long	think_time;
-
+	publish_state(philo, ST_THINKING);
+	probe_state(philo->id, ST_THINKING, 0);
+	trace_mark(philo, ST_THINKING);
 	print_state(philo, "is thinking");
-	if (philo->rules->num % 2 == 1)
-	{
-		think_time = philo->rules->t_die - (philo->rules->t_eat
-				+ philo->rules->t_sleep);
-		if (think_time > 0)
-			ft_usleep(think_time / 2);
-	}
+	adaptive_think(philo);
 }
 
-static int	setup_child_philo(t_rules *rules, int id, t_philo *philo)
+static void	setup_child_philo(t_rules *rules, int id, t_philo *philo)
 {
 	philo->id = id;
 	philo->meals = 0;
 	philo->last_meal = rules->start;
+	philo->meal_us = rules->start * 1000;
+	philo->slot = slot_offset(rules, id);
+	philo->held = 0;
+	philo->seated = 0;
+	philo->shared = &rules->slots[id - 1];
 	philo->rules = rules;
-	if (pthread_mutex_init(&philo->meal_mutex, NULL) != 0)
-	{
-		print_error("failed to initialize philosopher meal mutex");
-		exit(1);
-	}
-	if (pthread_create(&philo->monitor, NULL, &monitor_routine, philo) != 0)
-	{
-		print_error("failed to create philosopher monitor thread");
-		pthread_mutex_destroy(&philo->meal_mutex);
-		exit(1);
-	}
-	return (1);
 }
 
 static void	philo_loop(t_rules *rules, t_philo *philo)
 {
 	if (rules->has_must && rules->must_eat == 0)
 		exit(0);
-	if (philo->id % 2 == 0)
-		usleep(1000);
+	wait_until(philo, (rules->start + philo->slot) * 1000);
 	while (1)
 	{
 		take_forks(philo);
 		eat(philo);
 		release_forks(philo);
-		pthread_mutex_lock(&philo->meal_mutex);
 		if (rules->has_must && philo->meals >= rules->must_eat)
-		{
-			pthread_mutex_unlock(&philo->meal_mutex);
 			exit(0);
-		}
-		pthread_mutex_unlock(&philo->meal_mutex);
 		philo_sleep(philo);
 		philo_think(philo);
 	}
@@ -79,7 +68,14 @@ void	child_process(t_rules *rules, int id)
 {
 	t_philo	philo;
 
-	if (!setup_child_philo(rules, id, &philo))
+	setpgid(0, rules->pgid);
+	setvbuf(stdout, NULL, _IOLBF, 0);
+	pass_gate(rules);
+	prctl(PR_SET_PDEATHSIG, SIGKILL);
+	if (getppid() != rules->parent)
 		exit(1);
+	if (rules->startup_bench)
+		exit(0);
+	setup_child_philo(rules, id, &philo);
 	philo_loop(rules, &philo);
 }
@@ -0,0 +1,77 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   schedule_bonus.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:55:08 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 17:55:08 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_bonus.h"
+
+static long	at_least(long value, long floor)
+{
+	if (value < floor)
+		return (floor);
+	return (value);
+}
+
+static int	ring_closes(t_rules *rules)
+{
+	long	last;
+
+	last = (rules->num - 1) * rules->t_eat % rules->period;
+	return (last >= rules->t_eat && last + rules->t_eat <= rules->period);
+}
+
+void	build_schedule(t_rules *rules)
+{
+	long	busy;
+	long	half;
+
+	busy = at_least(rules->t_eat + rules->t_sleep, 1);
+	half = rules->num / 2;
+	rules->phases = 2;
+	if (rules->num < 2)
+		rules->period = busy;
+	else if (rules->num % 2 == 0)
+		rules->period = at_least(2 * rules->t_eat, busy);
+	else
+	{
+		rules->phases = rules->num;
+		rules->period = at_least((rules->num * rules->t_eat + half - 1)
+				/ half, busy);
+		if (!ring_closes(rules))
+		{
+			rules->phases = 3;
+			rules->period = at_least(3 * rules->t_eat, busy);
+		}
+	}
+}
+
+long	slot_offset(t_rules *rules, int id)
+{
+	if (rules->phases == 3 && id == rules->num)
+		return (2 * rules->t_eat);
+	if (rules->phases <= 3)
+		return (((id - 1) % 2) * rules->t_eat);
+	return ((id - 1) * rules->t_eat % rules->period);
+}
+
+long	slot_wait(t_philo *philo, long now)
+{
+	long	phase;
+
+	if (philo->rules->num < 2)
+		return (0);
+	phase = now - philo->rules->start - philo->slot;
+	if (phase < 0)
+		return (-phase);
+	phase %= philo->rules->period;
+	if (phase < philo->rules->t_eat + philo->rules->t_sleep)
+		return (0);
+	return (philo->rules->period - phase);
+}
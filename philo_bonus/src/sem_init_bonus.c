@@ -6,79 +6,44 @@
 /*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/23 12:00:00 by eabdelfa          #+#    #+#             */
-/*   Updated: 2026/01/31 18:19:57 by eabdelfa         ###   ########.fr       */
+/*   Updated: 2026/10/18 18:37:19 by eabdelfa         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "philo_bonus.h"
 
-static char	*make_sem_name(char *base)
+static int	init_sem(t_rules *rules, sem_t *sem, unsigned int value,
+		char *err)
 {
-	char	*pid_str;
-	char	*time_str;
-	char	*tmp1;
-	char	*tmp2;
-	char	*name;
-
-	pid_str = ft_itoa((int)getpid());
-	time_str = ft_itoa((int)(get_time_ms() % 100000));
-	tmp1 = ft_strjoin(base, "_");
-	tmp2 = ft_strjoin(tmp1, pid_str);
-	name = ft_strjoin(tmp2, time_str);
-	free(pid_str);
-	free(time_str);
-	free(tmp1);
-	free(tmp2);
-	return (name);
-}
-
-static void	cleanup_sem_names(t_rules *rules)
-{
-	free(rules->forks_name);
-	free(rules->print_name);
-	rules->forks_name = NULL;
-	rules->print_name = NULL;
-}
-
-static int	create_forks_sem(t_rules *rules)
-{
-	rules->forks = sem_open(rules->forks_name, O_CREAT, 0644, rules->num);
-	if (rules->forks == SEM_FAILED)
+	if (sem_init(sem, 1, value) != 0)
 	{
-		print_error("failed to create forks semaphore");
-		cleanup_sem_names(rules);
+		print_error(err);
 		return (0);
 	}
+	rules->sems_init++;
 	return (1);
 }
 
-static int	create_print_sem(t_rules *rules)
+static unsigned int	seat_count(t_rules *rules)
 {
-	rules->print = sem_open(rules->print_name, O_CREAT, 0644, 1);
-	if (rules->print == SEM_FAILED)
-	{
-		print_error("failed to create print semaphore");
-		sem_close(rules->forks);
-		sem_unlink(rules->forks_name);
-		cleanup_sem_names(rules);
-		return (0);
-	}
-	return (1);
+	if (rules->num < 2)
+		return (1);
+	return (rules->num / 2);
 }
 
 int	open_sems(t_rules *rules)
 {
-	rules->forks_name = make_sem_name("/philo_forks");
-	rules->print_name = make_sem_name("/philo_print");
-	if (!rules->forks_name || !rules->print_name)
-	{
-		print_error("failed to generate semaphore names");
-		cleanup_sem_names(rules);
-		return (0);
-	}
-	sem_unlink(rules->forks_name);
-	sem_unlink(rules->print_name);
-	if (!create_forks_sem(rules))
-		return (0);
-	return (create_print_sem(rules));
+	rules->forks = &rules->shared->forks;
+	rules->print = &rules->shared->print;
+	rules->seats = &rules->shared->seats;
+	return (init_sem(rules, rules->forks, rules->num,
+			"failed to create forks semaphore")
+		&& init_sem(rules, rules->print, 1,
+			"failed to create print semaphore")
+		&& init_sem(rules, &rules->shared->ready, 0,
+			"failed to create ready semaphore")
+		&& init_sem(rules, &rules->shared->gate, 0,
+			"failed to create start gate semaphore")
+		&& init_sem(rules, rules->seats, seat_count(rules),
+			"failed to create seats semaphore"));
 }
@@ -0,0 +1,48 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   shared_bonus.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:07:27 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 20:40:10 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_bonus.h"
+
+int	open_shared(t_rules *rules)
+{
+	void	*map;
+
+	rules->shared_size = sizeof(t_shared) + sizeof(t_slot) * rules->num;
+	map = mmap(NULL, rules->shared_size, PROT_READ | PROT_WRITE,
+			MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (map == MAP_FAILED)
+	{
+		print_error("failed to map shared philosopher state");
+		return (0);
+	}
+	rules->shared = (t_shared *)map;
+	rules->slots = rules->shared->slots;
+	return (1);
+}
+
+void	reset_slots(t_rules *rules)
+{
+	int	idx;
+
+	idx = 0;
+	while (idx < rules->num)
+	{
+		atomic_store(&rules->slots[idx].last_meal, rules->start);
+		atomic_store(&rules->slots[idx].meals, 0);
+		atomic_store(&rules->slots[idx].eating, 0);
+		atomic_store(&rules->slots[idx].max_gap, 0);
+		memset(&rules->slots[idx].think, 0, sizeof(t_think));
+		memset(&rules->slots[idx].lat, 0, sizeof(t_lat));
+		rules->slots[idx].think.min_budget = rules->t_die;
+		idx++;
+	}
+}
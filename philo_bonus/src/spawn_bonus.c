@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   spawn_bonus.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 22:09:57 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 22:09:57 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_bonus.h"
+
+static void	spawn_range(t_rules *rules, int first)
+{
+	int		idx;
+	int		last;
+	pid_t	pid;
+
+	if (rules->pgid == 0)
+		rules->pgid = getpid();
+	setpgid(0, rules->pgid);
+	prctl(PR_SET_PDEATHSIG, SIGKILL);
+	if (getppid() != rules->parent)
+		exit(1);
+	last = first + FANOUT;
+	if (last > rules->num)
+		last = rules->num;
+	idx = first;
+	while (idx < last)
+	{
+		pid = fork();
+		if (pid == 0)
+			child_process(rules, idx + 1);
+		if (pid < 0)
+			exit(1);
+		rules->slots[idx].pid = pid;
+		idx++;
+	}
+	exit(0);
+}
+
+static int	wait_spawners(int count)
+{
+	int	status;
+	int	failed;
+
+	failed = 0;
+	while (count > 0)
+	{
+		status = 0;
+		if (waitpid(-1, &status, 0) < 0 || !WIFEXITED(status)
+			|| WEXITSTATUS(status) != 0)
+			failed = 1;
+		count--;
+	}
+	return (!failed);
+}
+
+static int	watch_all(t_rules *rules)
+{
+	int	idx;
+
+	idx = 0;
+	while (idx < rules->num)
+	{
+		if (!watch_child(rules, idx, rules->slots[idx].pid))
+			return (0);
+		idx++;
+	}
+	return (1);
+}
+
+int	spawn_children(t_rules *rules)
+{
+	int		first;
+	int		spawned;
+	pid_t	pid;
+
+	first = 0;
+	spawned = 0;
+	while (first < rules->num)
+	{
+		pid = fork();
+		if (pid == 0)
+			spawn_range(rules, first);
+		if (pid < 0)
+			break ;
+		if (rules->pgid == 0)
+			rules->pgid = pid;
+		setpgid(pid, rules->pgid);
+		spawned++;
+		first += FANOUT;
+	}
+	if (!wait_spawners(spawned) || first < rules->num)
+		return (error_exit("failed to create child process", 0));
+	return (watch_all(rules));
+}
@@ -6,7 +6,7 @@
 /*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/22 23:04:49 by eabdelfa          #+#    #+#             */
-/*   Updated: 2026/02/02 23:19:09 by eabdelfa         ###   ########.fr       */
+/*   Updated: 2026/10/18 20:40:10 by eabdelfa         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,75 +14,70 @@
 
 static void	kill_all(t_rules *rules)
 {
-	int	philo_idx;
+	if (rules->pgid > 0)
+		killpg(rules->pgid, SIGKILL);
+}
 
-	philo_idx = 0;
-	while (philo_idx < rules->num)
-	{
-		if (rules->pids[philo_idx] > 0)
-			kill(rules->pids[philo_idx], SIGKILL);
-		philo_idx++;
-	}
+int	fork_children(t_rules *rules)
+{
+	rules->parent = getpid();
+	prctl(PR_SET_CHILD_SUBREAPER, 1L, 0L, 0L, 0L);
+	if (spawn_children(rules))
+		return (0);
+	kill_all(rules);
+	return (1);
 }
 
-static int	fork_children(t_rules *rules)
+void	reap_children(t_rules *rules)
 {
-	int		philo_idx;
 	pid_t	child_pid;
 
-	philo_idx = 0;
-	while (philo_idx < rules->num)
-	{
-		child_pid = fork();
-		if (child_pid < 0)
-		{
-			print_error("failed to create child process");
-			kill_all(rules);
-			return (1);
-		}
-		if (child_pid == 0)
-			child_process(rules, philo_idx + 1);
-		rules->pids[philo_idx] = child_pid;
-		philo_idx++;
-	}
-	return (0);
+	while (rules->live > 0)
+		wait_children(rules, -1);
+	child_pid = waitpid(-1, NULL, 0);
+	while (child_pid > 0)
+		child_pid = waitpid(-1, NULL, 0);
 }
 
-static int	wait_children(t_rules *rules)
+static void	stop_children(t_rules *rules)
 {
-	int	exit_status;
-	int	completed_count;
-	int	child_pid;
+	long	until;
+	long	now;
 
-	completed_count = 0;
-	while (1)
+	raise_stop(rules);
+	release_waiters(rules);
+	until = get_time_ms() + STOP_TIMEOUT_MS;
+	now = get_time_ms();
+	while (rules->live > 0 && now < until)
 	{
-		child_pid = waitpid(-1, &exit_status, 0);
-		if (child_pid <= 0)
-			break ;
-		if (WIFEXITED(exit_status) && WEXITSTATUS(exit_status) == 1)
-			return (1);
-		if (WIFEXITED(exit_status) && WEXITSTATUS(exit_status) == 0)
-		{
-			completed_count++;
-			if (rules->has_must && completed_count == rules->num)
-				return (2);
-		}
+		wait_children(rules, until - now);
+		now = get_time_ms();
 	}
-	return (0);
+	rules->killed = rules->live;
+	if (rules->live > 0)
+		kill_all(rules);
 }
 
 int	start_simulation(t_rules *rules)
 {
-	int	result;
+	long	end;
 
 	if (rules->has_must && rules->must_eat == 0)
 		return (0);
-	rules->start = get_time_ms();
 	if (fork_children(rules))
+	{
+		reap_children(rules);
 		return (1);
-	result = wait_children(rules);
-	if (result == 1 || result == 2)
-		kill_all(rules);
+	}
+	wait_ready(rules);
+	open_gate(rules);
+	rules->end_reason = monitor_children(rules);
+	end = get_time_us();
+	summary_tick(rules, NULL, 1);
+	rules->end = end / 1000;
+	probe_sim(rules, 0);
+	stop_children(rules);
+	reap_children(rules);
+	rules->teardown_us = get_time_us() - end;
 	return (0);
 }
@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   startup_bonus.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:17:24 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 18:17:24 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_bonus.h"
+
+static int	bench_size(int round)
+{
+	if (round == 0)
+		return (50);
+	if (round == 1)
+		return (200);
+	return (1000);
+}
+
+static int	bench_run(t_rules *rules, t_bench *res)
+{
+	long	begin;
+	long	forked;
+	long	ready;
+
+	begin = 0;
+	if (open_table(rules))
+		begin = get_time_us();
+	if (!begin || fork_children(rules))
+	{
+		reap_children(rules);
+		cleanup_rules(rules);
+		return (0);
+	}
+	forked = get_time_us() - begin;
+	wait_ready(rules);
+	ready = get_time_us() - begin;
+	open_gate(rules);
+	reap_children(rules);
+	cleanup_rules(rules);
+	res->fork_us += forked;
+	res->ready_us += ready;
+	if (ready > res->worst_us)
+		res->worst_us = ready;
+	return (1);
+}
+
+static void	print_bench(t_bench *res)
+{
+	int		round;
+	char	*sep;
+
+	printf("{\n  \"startup_bench\": {\n    \"runs\": %d,\n    \"sizes\": [\n",
+		BENCH_RUNS);
+	round = 0;
+	while (round < BENCH_SIZES)
+	{
+		sep = ",";
+		if (round == BENCH_SIZES - 1)
+			sep = "";
+		printf("      {\"n\": %d, \"fork_ms_avg\": %.3f, "
+			"\"ready_ms_avg\": %.3f, \"ready_ms_max\": %.3f}%s\n",
+			res[round].num, res[round].fork_us / 1000.0 / BENCH_RUNS,
+			res[round].ready_us / 1000.0 / BENCH_RUNS,
+			res[round].worst_us / 1000.0, sep);
+		round++;
+	}
+	printf("    ]\n  }\n}\n");
+}
+
+int	startup_bench(t_rules *rules)
+{
+	t_bench	res[BENCH_SIZES];
+	int		round;
+	int		run;
+
+	memset(res, 0, sizeof(res));
+	round = 0;
+	while (round < BENCH_SIZES)
+	{
+		res[round].num = bench_size(round);
+		rules->num = res[round].num;
+		run = 0;
+		while (run < BENCH_RUNS)
+		{
+			if (!bench_run(rules, &res[round]))
+				return (1);
+			run++;
+		}
+		round++;
+	}
+	print_bench(res);
+	return (0);
+}
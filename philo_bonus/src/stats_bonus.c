@@ -0,0 +1,74 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stats_bonus.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:45:28 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 19:29:00 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_bonus.h"
+
+static void	print_philo_stats(t_rules *rules, int idx)
+{
+	t_think	*think;
+	long	avg;
+	char	*sep;
+
+	think = &rules->slots[idx].think;
+	avg = 0;
+	if (think->decisions > 0)
+		avg = think->total / think->decisions;
+	sep = ",";
+	if (idx == rules->num - 1)
+		sep = "";
+	fprintf(stderr, "      {\"id\": %d, \"slot_ms\": %ld, \"meals\": %d, "
+		"\"decisions\": %ld, "
+		"\"think_ms_total\": %ld, \"think_ms_avg\": %ld, \"capped\": %ld, "
+		"\"min_budget_ms\": %ld, \"fork_wait_ewma_ms\": %ld}%s\n",
+		idx + 1, slot_offset(rules, idx + 1),
+		atomic_load(&rules->slots[idx].meals), think->decisions,
+		think->total, avg, think->capped, think->min_budget,
+		think->wait_est >> 4, sep);
+}
+
+static void	print_teardown(t_rules *rules)
+{
+	char	*reason;
+
+	reason = "died";
+	if (rules->end_reason == 2)
+		reason = "all_fed";
+	else if (rules->end_reason == 3)
+		reason = "child_failed";
+	fprintf(stderr, "  \"teardown\": {\"reason\": \"%s\", "
+		"\"death_late_us\": %ld, \"end_to_last_reap_us\": %ld, "
+		"\"killed\": %d},\n", reason,
+		atomic_load(&rules->shared->death_late_us), rules->teardown_us,
+		rules->killed);
+}
+
+void	print_stats(t_rules *rules)
+{
+	int	idx;
+
+	if (!rules->stats || !rules->slots)
+		return ;
+	fprintf(stderr, "{\n  \"schedule\": {\"phases\": %d, "
+		"\"period_ms\": %ld},\n", rules->phases, rules->period);
+	print_teardown(rules);
+	fprintf(stderr, "  \"think_controller\": {\n"
+		"    \"margin_ms\": %ld,\n    \"philos\": [\n", rules->margin);
+	idx = 0;
+	while (idx < rules->num)
+	{
+		print_philo_stats(rules, idx);
+		idx++;
+	}
+	fprintf(stderr, "    ]\n  },\n");
+	print_latency(rules);
+	fprintf(stderr, "}\n");
+}
@@ -0,0 +1,61 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stop_bonus.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:49:32 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 18:49:32 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_bonus.h"
+
+void	raise_stop(t_rules *rules)
+{
+	atomic_store(&rules->shared->stop, 1);
+	syscall(SYS_futex, &rules->shared->stop, FUTEX_WAKE, INT_MAX,
+		NULL, NULL, 0);
+}
+
+void	release_waiters(t_rules *rules)
+{
+	int	idx;
+
+	idx = 0;
+	while (idx < rules->num)
+	{
+		sem_post(rules->forks);
+		sem_post(rules->seats);
+		idx++;
+	}
+}
+
+void	leave_table(t_philo *philo)
+{
+	while (philo->held > 0)
+	{
+		sem_post(philo->rules->forks);
+		philo->held--;
+	}
+	if (philo->seated)
+		sem_post(philo->rules->seats);
+	philo->seated = 0;
+	exit(0);
+}
+
+void	sleep_until(t_philo *philo, long when_us)
+{
+	struct timespec	ts;
+	atomic_int		*stop;
+
+	stop = &philo->rules->shared->stop;
+	ts.tv_sec = when_us / 1000000;
+	ts.tv_nsec = (when_us % 1000000) * 1000;
+	while (!atomic_load(stop) && get_time_us() < when_us)
+		syscall(SYS_futex, stop, FUTEX_WAIT_BITSET | FUTEX_CLOCK_REALTIME, 0,
+			&ts, NULL, FUTEX_BITSET_MATCH_ANY);
+	if (atomic_load(stop))
+		leave_table(philo);
+}
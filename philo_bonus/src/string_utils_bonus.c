@@ -1,62 +0,0 @@
-/* ************************************************************************** */
-/*                                                                            */
-/*                                                        :::      ::::::::   */
-/*   string_utils_bonus.c                               :+:      :+:    :+:   */
-/*                                                    +:+ +:+         +:+     */
-/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
-/*                                                +#+#+#+#+#+   +#+           */
-/*   Created: 2026/01/23 12:00:00 by eabdelfa          #+#    #+#             */
-/*   Updated: 2026/01/23 17:02:44 by eabdelfa         ###   ########.fr       */
-/*                                                                            */
-/* ************************************************************************** */
-
-#include "philo_bonus.h"
-
-char	*ft_strdup(char *s)
-{
-	char	*dup;
-	size_t	len;
-	size_t	i;
-
-	len = ft_strlen(s);
-	dup = malloc(len + 1);
-	if (!dup)
-		return (NULL);
-	i = 0;
-	while (i < len)
-	{
-		dup[i] = s[i];
-		i++;
-	}
-	dup[i] = '\0';
-	return (dup);
-}
-
-char	*ft_strjoin(char *s1, char *s2)
-{
-	char	*res;
-	size_t	l1;
-	size_t	l2;
-	size_t	i;
-
-	if (!s1 || !s2)
-		return (NULL);
-	l1 = ft_strlen(s1);
-	l2 = ft_strlen(s2);
-	res = malloc(l1 + l2 + 1);
-	if (!res)
-		return (NULL);
-	i = 0;
-	while (i < l1)
-	{
-		res[i] = s1[i];
-		i++;
-	}
-	while (i < l1 + l2)
-	{
-		res[i] = s2[i - l1];
-		i++;
-	}
-	res[i] = '\0';
-	return (res);
-}
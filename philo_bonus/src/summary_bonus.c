@@ -0,0 +1,96 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   summary_bonus.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 20:36:27 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 20:36:27 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_bonus.h"
+
+static long	slot_gap(t_rules *rules, t_slot *slot, long now)
+{
+	long	gap;
+	long	open;
+
+	gap = atomic_exchange(&slot->max_gap, 0);
+	if (rules->has_must && atomic_load(&slot->meals) >= rules->must_eat)
+		return (gap);
+	open = now - atomic_load(&slot->last_meal);
+	if (open > gap)
+		return (open);
+	return (gap);
+}
+
+static void	scan_slots(t_rules *rules, t_sum *sum, long now)
+{
+	long	gap;
+	int		idx;
+
+	sum->seen = 0;
+	sum->eating = 0;
+	if (!sum->pending)
+	{
+		sum->worst = 0;
+		sum->worst_id = 0;
+	}
+	idx = 0;
+	while (idx < rules->num)
+	{
+		sum->seen += atomic_load(&rules->slots[idx].meals);
+		sum->eating += atomic_load(&rules->slots[idx].eating);
+		gap = slot_gap(rules, &rules->slots[idx], now);
+		if (gap > sum->worst)
+		{
+			sum->worst = gap;
+			sum->worst_id = idx + 1;
+		}
+		idx++;
+	}
+}
+
+static void	print_summary(t_rules *rules, long ts)
+{
+	t_sum	*sum;
+
+	sum = &rules->sum;
+	sem_wait(rules->print);
+	printf("%ld summary meals=%ld total=%ld eating=%d min_slack=%ld "
+		"slack_id=%d\n", ts - rules->start, sum->seen - sum->total,
+		sum->seen, sum->eating, rules->t_die - sum->worst, sum->worst_id);
+	sem_post(rules->print);
+	sum->total = sum->seen;
+	sum->pending = 0;
+}
+
+void	summary_tick(t_rules *rules, int *wait_ms, int final)
+{
+	t_sum	*sum;
+	long	now;
+
+	if (!rules->summary)
+		return ;
+	sum = &rules->sum;
+	now = get_time_ms();
+	if (sum->next == 0)
+		sum->next = rules->start + rules->summary;
+	if (sum->pending && now > sum->pending)
+		print_summary(rules, sum->pending);
+	if (final || (now >= sum->next && !sum->pending))
+	{
+		scan_slots(rules, sum, now);
+		sum->pending = now;
+	}
+	if (final)
+		print_summary(rules, now);
+	while (sum->next <= now)
+		sum->next += rules->summary;
+	if (wait_ms && *wait_ms > sum->next - now)
+		*wait_ms = sum->next - now;
+	if (wait_ms && sum->pending)
+		*wait_ms = 1;
+}
@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   supervise_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:38:39 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 18:38:39 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_bonus.h"
+
+int	open_supervisor(t_rules *rules)
+{
+	int	idx;
+
+	rules->pidfds = malloc(sizeof(int) * rules->num);
+	if (!rules->pidfds)
+		return (error_exit("memory allocation failed for pidfds", 0));
+	idx = 0;
+	while (idx < rules->num)
+		rules->pidfds[idx++] = -1;
+	rules->epfd = epoll_create1(0);
+	if (rules->epfd < 0)
+		return (error_exit("failed to create epoll instance", 0));
+	return (1);
+}
+
+void	close_supervisor(t_rules *rules)
+{
+	int	idx;
+
+	if (!rules->pidfds)
+		return ;
+	idx = 0;
+	while (idx < rules->num)
+	{
+		if (rules->pidfds[idx] >= 0)
+			close(rules->pidfds[idx]);
+		idx++;
+	}
+	if (rules->epfd >= 0)
+		close(rules->epfd);
+	free(rules->pidfds);
+	rules->pidfds = NULL;
+	rules->live = 0;
+	rules->pgid = 0;
+}
+
+int	watch_child(t_rules *rules, int idx, pid_t pid)
+{
+	struct epoll_event	ev;
+
+	if (pid < 0)
+		return (error_exit("failed to create child process", 0));
+	rules->pids[idx] = pid;
+	if (rules->pgid == 0)
+		rules->pgid = pid;
+	setpgid(pid, rules->pgid);
+	rules->pidfds[idx] = pidfd_open(pid, 0);
+	if (rules->pidfds[idx] < 0)
+		return (error_exit("failed to open child pidfd", 0));
+	ev.events = EPOLLIN;
+	ev.data.u32 = idx;
+	if (epoll_ctl(rules->epfd, EPOLL_CTL_ADD, rules->pidfds[idx], &ev) != 0)
+		return (error_exit("failed to watch child process", 0));
+	rules->live++;
+	return (1);
+}
+
+static int	reap_child(t_rules *rules, int idx)
+{
+	int	status;
+
+	status = 0;
+	waitpid(rules->pids[idx], &status, 0);
+	epoll_ctl(rules->epfd, EPOLL_CTL_DEL, rules->pidfds[idx], NULL);
+	close(rules->pidfds[idx]);
+	rules->pidfds[idx] = -1;
+	rules->pids[idx] = 0;
+	rules->live--;
+	return (!WIFEXITED(status) || WEXITSTATUS(status) != 0);
+}
+
+int	wait_children(t_rules *rules, int timeout_ms)
+{
+	struct epoll_event	ev[16];
+	int					count;
+	int					idx;
+	int					failed;
+
+	failed = 0;
+	count = epoll_wait(rules->epfd, ev, 16, timeout_ms);
+	idx = 0;
+	while (idx < count)
+	{
+		if (reap_child(rules, ev[idx].data.u32))
+			failed = 1;
+		idx++;
+	}
+	return (failed);
+}
@@ -0,0 +1,53 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   think_bonus.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:45:28 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 18:48:25 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_bonus.h"
+
+static long	think_budget(t_philo *philo, long now)
+{
+	return (philo->rules->t_die - philo->rules->margin
+		- (now - philo->last_meal) - (philo->shared->think.wait_est >> 4));
+}
+
+void	record_fork_wait(t_philo *philo, long wait)
+{
+	t_think	*think;
+
+	think = &philo->shared->think;
+	think->wait_est += ((wait << 4) - think->wait_est) >> 2;
+}
+
+void	adaptive_think(t_philo *philo)
+{
+	t_think	*think;
+	long	now;
+	long	budget;
+	long	target;
+
+	think = &philo->shared->think;
+	now = get_time_ms();
+	budget = think_budget(philo, now);
+	if (budget < think->min_budget)
+		think->min_budget = budget;
+	target = slot_wait(philo, now);
+	if (target > budget)
+	{
+		target = budget;
+		think->capped++;
+	}
+	if (target > 0)
+	{
+		wait_until(philo, get_time_us() + target * 1000);
+		think->total += target;
+	}
+	think->decisions++;
+}
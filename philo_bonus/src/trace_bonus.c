@@ -0,0 +1,59 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace_bonus.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:51:55 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 19:51:55 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_bonus.h"
+
+int	open_trace(t_rules *rules)
+{
+	void	*map;
+
+	if (!rules->trace_path)
+		return (1);
+	map = mmap(NULL, sizeof(t_tbuf) * rules->num, PROT_READ | PROT_WRITE,
+			MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (map == MAP_FAILED)
+		return (0);
+	rules->trace = map;
+	return (1);
+}
+
+void	close_trace(t_rules *rules)
+{
+	if (rules->trace)
+		munmap(rules->trace, sizeof(t_tbuf) * rules->num);
+	rules->trace = NULL;
+}
+
+void	trace_mark(t_philo *philo, int state)
+{
+	t_tbuf	*buf;
+
+	if (!philo->rules->trace)
+		return ;
+	buf = &philo->rules->trace[philo->id - 1];
+	if (buf->count == TRACE_CAP)
+	{
+		buf->dropped++;
+		return ;
+	}
+	buf->ev[buf->count].ts = get_time_us() - philo->rules->start * 1000;
+	buf->ev[buf->count].state = state;
+	buf->count++;
+}
+
+void	trace_death(t_rules *rules)
+{
+	if (!rules->trace)
+		return ;
+	atomic_store(&rules->shared->death_us,
+		get_time_us() - rules->start * 1000);
+}
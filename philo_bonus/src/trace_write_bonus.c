@@ -0,0 +1,81 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace_write_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:51:55 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 19:51:55 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_bonus.h"
+
+static void	write_slice(FILE *out, int id, t_tev *ev, long end)
+{
+	static char	*names[] = {"idle", "fork wait", "eat", "sleep", "think",
+		"died"};
+
+	fprintf(out, ",\n{\"name\": \"%s\", \"ph\": \"X\", \"pid\": 1, "
+		"\"tid\": %d, \"ts\": %ld, \"dur\": %ld}", names[ev->state], id,
+		ev->ts, end - ev->ts);
+}
+
+static long	write_philo(FILE *out, t_rules *rules, int idx)
+{
+	t_tbuf	*buf;
+	long	end;
+	long	pos;
+
+	buf = &rules->trace[idx];
+	fprintf(out, ",\n{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, "
+		"\"tid\": %d, \"args\": {\"name\": \"philo %d\"}}", idx + 1, idx + 1);
+	pos = 0;
+	while (pos < buf->count)
+	{
+		end = (rules->end - rules->start) * 1000;
+		if (pos + 1 < buf->count)
+			end = buf->ev[pos + 1].ts;
+		if (end > buf->ev[pos].ts)
+			write_slice(out, idx + 1, &buf->ev[pos], end);
+		pos++;
+	}
+	return (buf->dropped);
+}
+
+static void	write_death(FILE *out, t_rules *rules)
+{
+	if (!atomic_load(&rules->shared->dead))
+		return ;
+	fprintf(out, ",\n{\"name\": \"died\", \"ph\": \"i\", \"s\": \"p\", "
+		"\"pid\": 1, \"tid\": %d, \"ts\": %ld}",
+		atomic_load(&rules->shared->dead),
+		atomic_load(&rules->shared->death_us));
+}
+
+int	write_trace(t_rules *rules)
+{
+	FILE	*out;
+	long	dropped;
+	int		idx;
+
+	if (!rules->trace)
+		return (1);
+	out = fopen(rules->trace_path, "w");
+	if (!out)
+		return (error_exit("cannot open trace file", 0));
+	fprintf(out, "{\"traceEvents\": [\n{\"name\": \"process_name\", "
+		"\"ph\": \"M\", \"pid\": 1, \"args\": {\"name\": \"philo_bonus\"}}");
+	dropped = 0;
+	idx = 0;
+	while (idx < rules->num)
+	{
+		dropped += write_philo(out, rules, idx);
+		idx++;
+	}
+	write_death(out, rules);
+	fprintf(out, "\n], \"displayTimeUnit\": \"ms\", \"otherData\": "
+		"{\"start_ms\": %ld, \"dropped\": %ld}}\n", rules->start, dropped);
+	return (fclose(out) == 0);
+}
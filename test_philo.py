@@ -45,6 +45,8 @@ class PhiloTester:
 				text=True
 			)
 			output = result.stdout
+			if result.returncode < 0:
+				return False, f"Crashed with signal {-result.returncode}"
 		except subprocess.TimeoutExpired:
 			output = "TIMEOUT"
 		except Exception as e:
@@ -187,6 +189,27 @@ def get_mandatory_tests() -> List[TestCase]:
 			expected_death=False,
 			description="With must_eat=0, simulation stops immediately without eating"
 		),
+		TestCase(
+			name="Zero eat and sleep (three philosophers)",
+			args=["3", "100", "0", "0"],
+			timeout=2,
+			expected_death=False,
+			description="A zero schedule period must not crash the simulation"
+		),
+		TestCase(
+			name="Zero eat and sleep with must_eat=2",
+			args=["4", "100", "0", "0", "2"],
+			timeout=5,
+			expected_death=False,
+			description="Even table with zero timings finishes its meals"
+		),
+		TestCase(
+			name="Zero eat and sleep, odd table with must_eat=2",
+			args=["5", "100", "0", "0", "2"],
+			timeout=5,
+			expected_death=False,
+			description="Odd table with zero timings finishes its meals"
+		),
 	]
 
 
@@ -258,6 +281,27 @@ def get_bonus_tests() -> List[TestCase]:
 			expected_death=False,
 			description="With must_eat=0, all child processes exit immediately without eating"
 		),
+		TestCase(
+			name="Zero eat and sleep (three philosophers)",
+			args=["3", "100", "0", "0"],
+			timeout=2,
+			expected_death=False,
+			description="A zero schedule period must not crash the processes"
+		),
+		TestCase(
+			name="Zero eat and sleep with must_eat=2",
+			args=["4", "100", "0", "0", "2"],
+			timeout=5,
+			expected_death=False,
+			description="Even table with zero timings finishes its meals"
+		),
+		TestCase(
+			name="Zero eat and sleep, odd table with must_eat=2",
+			args=["5", "100", "0", "0", "2"],
+			timeout=5,
+			expected_death=False,
+			description="Odd table with zero timings finishes its meals"
+		),
 	]
 
 
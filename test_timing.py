@@ -0,0 +1,246 @@
+#!/usr/bin/env python3
+"""
+Timing-accuracy suite for Philo and Philo_Bonus
+Runs each scenario many times with --trace and --stats, computes latency
+distributions from the microsecond timeline and gates them on p99 thresholds,
+on an idle machine and while CPU hog processes compete for every core.
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+import tempfile
+from dataclasses import dataclass, field
+from typing import Dict, List, Optional
+
+from test_philo import build_binaries, find_binary
+
+
+@dataclass
+class Scenario:
+	"""A parameter set and the metrics it is used to measure"""
+	name: str
+	args: List[str]
+	metrics: List[str]
+	timeout: int = 15
+
+
+@dataclass
+class Samples:
+	"""Collected samples per metric, in microseconds"""
+	values: Dict[str, List[int]] = field(default_factory=dict)
+	failures: List[str] = field(default_factory=list)
+
+	def add(self, metric: str, value: int):
+		self.values.setdefault(metric, []).append(value)
+
+
+SCENARIOS = [
+	Scenario("survive 5 800 200 200", ["5", "800", "200", "200", "6"],
+		["eat_overshoot", "sleep_overshoot", "startup_skew"]),
+	Scenario("survive 200 800 200 200", ["200", "800", "200", "200", "3"],
+		["eat_overshoot", "sleep_overshoot", "startup_skew"]),
+	Scenario("death 1 400 200 200", ["1", "400", "200", "200"],
+		["death_late"]),
+	Scenario("death 4 310 200 100", ["4", "310", "200", "100"],
+		["death_late"]),
+	Scenario("death 3 400 300 100", ["3", "400", "300", "100"],
+		["death_late"]),
+]
+
+
+# Per-binary p99 limits in ms. philo_bonus gets wider eat, sleep and skew
+# limits. Its 200 children are separate processes, and they all print through
+# one unnamed semaphore that sem_init placed in the shared mapping. The
+# hundred children that end a phase together take it one at a time, each
+# handoff is a futex wakeup of another process, and each holder writes its
+# line before it posts. On one CPU the last of them runs many ms late. Idle
+# single-CPU runs measured a sleep overshoot p99 of 13-43 ms and a startup
+# skew p99 of 16-31 ms on the 200-philosopher table.
+DEFAULT_LIMITS = {
+	"philo": {"death_late": 10.0, "eat_overshoot": 15.0,
+		"sleep_overshoot": 15.0, "startup_skew": 20.0},
+	"philo_bonus": {"death_late": 10.0, "eat_overshoot": 40.0,
+		"sleep_overshoot": 40.0, "startup_skew": 40.0},
+}
+
+
+def percentile(values: List[int], pct: float) -> int:
+	"""Nearest-rank percentile"""
+	ordered = sorted(values)
+	rank = max(1, -(-len(ordered) * pct // 100))
+	return ordered[int(rank) - 1]
+
+
+def slices_by_philo(trace: dict) -> Dict[int, List[dict]]:
+	"""Group the duration slices of a trace by philosopher"""
+	tracks: Dict[int, List[dict]] = {}
+	for event in trace["traceEvents"]:
+		if event.get("ph") == "X":
+			tracks.setdefault(event["tid"], []).append(event)
+	for events in tracks.values():
+		events.sort(key=lambda e: e["ts"])
+	return tracks
+
+
+def collect(trace: dict, stats: Optional[dict], args: List[str],
+		samples: Samples):
+	"""Turn one run's trace into samples"""
+	t_die, t_eat, t_sleep = (int(a) * 1000 for a in args[1:4])
+	tracks = slices_by_philo(trace)
+	for tid, events in tracks.items():
+		for event in events[:-1]:
+			if event["name"] == "eat":
+				samples.add("eat_overshoot", event["dur"] - t_eat)
+			elif event["name"] == "sleep":
+				samples.add("sleep_overshoot", event["dur"] - t_sleep)
+		if stats and events:
+			slot = stats["think_controller"]["philos"][tid - 1]["slot_ms"]
+			samples.add("startup_skew", events[0]["ts"] - slot * 1000)
+	for event in trace["traceEvents"]:
+		if event.get("ph") == "i" and event["name"] == "died":
+			meals = [e["ts"] for e in tracks.get(event["tid"], [])
+				if e["name"] == "eat" and e["ts"] < event["ts"]]
+			last_meal = meals[-1] if meals else 0
+			samples.add("death_late", event["ts"] - (last_meal + t_die))
+
+
+def run_once(binary: str, scenario: Scenario, samples: Samples):
+	"""Run one simulation and collect its samples"""
+	with tempfile.NamedTemporaryFile(suffix=".json") as tmp:
+		cmd = [binary, "--stats", f"--trace={tmp.name}"] + scenario.args
+		try:
+			result = subprocess.run(cmd, capture_output=True, text=True,
+				timeout=scenario.timeout)
+		except subprocess.TimeoutExpired:
+			samples.failures.append(f"{scenario.name}: timeout")
+			return
+		died = " died" in result.stdout
+		if died != ("death_late" in scenario.metrics):
+			samples.failures.append(f"{scenario.name}: unexpected outcome")
+		try:
+			stats = json.loads(result.stderr) if result.stderr else None
+			with open(tmp.name) as f:
+				trace = json.load(f)
+		except (OSError, ValueError) as e:
+			samples.failures.append(f"{scenario.name}: {e}")
+			return
+		collect(trace, stats, scenario.args, samples)
+
+
+def start_hogs(count: int) -> List[subprocess.Popen]:
+	"""Start busy-looping processes, one per requested core"""
+	return [subprocess.Popen([sys.executable, "-c", "while True: pass"])
+		for _ in range(count)]
+
+
+def stop_hogs(hogs: List[subprocess.Popen]):
+	"""Kill and reap the hog processes"""
+	for hog in hogs:
+		hog.kill()
+	for hog in hogs:
+		hog.wait()
+
+
+def report(label: str, samples: Samples, limits: Dict[str, float]) -> bool:
+	"""Print p50/p99/max per metric and gate on the p99 limits"""
+	passed = not samples.failures
+	print(f"\n{label}")
+	print(f"  {'metric':<16} {'n':>6} {'p50 ms':>9} {'p99 ms':>9} "
+		f"{'max ms':>9} {'limit':>7}")
+	for metric in limits:
+		values = samples.values.get(metric)
+		if not values:
+			continue
+		p99 = percentile(values, 99)
+		ok = p99 <= limits[metric] * 1000
+		passed = passed and ok
+		print(f"  {metric:<16} {len(values):>6} "
+			f"{percentile(values, 50) / 1000:>9.3f} {p99 / 1000:>9.3f} "
+			f"{max(values) / 1000:>9.3f} {limits[metric]:>7.1f} "
+			f"{'✓' if ok else '✗ FAIL'}")
+	for failure in samples.failures:
+		print(f"  ✗ {failure}")
+	return passed
+
+
+def limits_for(binary: str, overrides: Dict[str, Optional[float]]
+		) -> Dict[str, float]:
+	"""The default limits of a binary with the command-line overrides"""
+	limits = dict(DEFAULT_LIMITS[os.path.basename(binary)])
+	for metric, value in overrides.items():
+		if value is not None:
+			limits[metric] = value
+	return limits
+
+
+def run_suite(binaries: List[str], runs: int, hogs: int,
+		overrides: Dict[str, Optional[float]]) -> bool:
+	"""Run every scenario on every binary, idle and then under load"""
+	all_passed = True
+	for load in ([0, hogs] if hogs > 0 else [0]):
+		procs = start_hogs(load)
+		try:
+			for binary in binaries:
+				samples = Samples()
+				for scenario in SCENARIOS:
+					for _ in range(runs):
+						run_once(binary, scenario, samples)
+				label = (f"{os.path.basename(binary)} "
+					f"({'idle' if load == 0 else f'{load} CPU hogs'}, "
+					f"{runs} runs per scenario)")
+				all_passed = report(label, samples,
+					limits_for(binary, overrides)) and all_passed
+		finally:
+			stop_hogs(procs)
+	return all_passed
+
+
+def main():
+	"""Main entry point"""
+	parser = argparse.ArgumentParser(description=__doc__,
+		formatter_class=argparse.RawDescriptionHelpFormatter)
+	parser.add_argument("--runs", type=int, default=10,
+		help="runs per scenario and binary (default 10)")
+	parser.add_argument("--hogs", type=int, default=os.cpu_count(),
+		help="CPU hog processes for the loaded pass, 0 to skip "
+		"(default: one per core)")
+	parser.add_argument("--death-p99", type=float,
+		help="p99 limit for death-report lateness in ms (default 10)")
+	parser.add_argument("--eat-p99", type=float,
+		help="p99 limit for eat overshoot in ms (default 15, "
+		"philo_bonus 40)")
+	parser.add_argument("--sleep-p99", type=float,
+		help="p99 limit for sleep overshoot in ms (default 15, "
+		"philo_bonus 40)")
+	parser.add_argument("--skew-p99", type=float,
+		help="p99 limit for first-event startup skew in ms (default 20, "
+		"philo_bonus 40)")
+	parser.add_argument("--only", choices=["philo", "philo_bonus"],
+		help="run a single binary")
+	opts = parser.parse_args()
+
+	project_root = os.path.dirname(os.path.abspath(__file__))
+	names = [opts.only] if opts.only else ["philo", "philo_bonus"]
+	try:
+		binaries = [find_binary(name, project_root) for name in names]
+	except FileNotFoundError:
+		if not build_binaries(project_root):
+			sys.exit(1)
+		binaries = [find_binary(name, project_root) for name in names]
+
+	overrides = {
+		"death_late": opts.death_p99,
+		"eat_overshoot": opts.eat_p99,
+		"sleep_overshoot": opts.sleep_p99,
+		"startup_skew": opts.skew_p99,
+	}
+	passed = run_suite(binaries, opts.runs, opts.hogs, overrides)
+	print(f"\n{'PASSED ✓' if passed else 'FAILED ✗'}\n")
+	sys.exit(0 if passed else 1)
+
+
+if __name__ == "__main__":
+	main()
@@ -0,0 +1,77 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   philo_check.h                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 20:19:58 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 20:19:58 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PHILO_CHECK_H
+# define PHILO_CHECK_H
+
+# include <fcntl.h>
+# include <limits.h>
+# include <stdio.h>
+# include <stdlib.h>
+# include <string.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <time.h>
+# include <unistd.h>
+
+# define CHECK_CHUNK 1048576
+# define CHECK_SHOWN 20
+# define CHECK_TOLERANCE 10
+
+typedef struct s_seat
+{
+	long	meals;
+	long	last_meal;
+	long	eat_ts;
+	long	sleep_ts;
+	long	max_gap;
+	int		held;
+	int		eating;
+}			t_seat;
+
+typedef struct s_check
+{
+	long	num;
+	long	t_die;
+	long	t_eat;
+	long	t_sleep;
+	long	must_eat;
+	long	tolerance;
+	int		pool;
+	char	*path;
+	t_seat	*seats;
+	long	held;
+	long	lines;
+	long	bytes;
+	long	last_ts;
+	long	meals;
+	long	died_id;
+	long	died_ts;
+	long	violations;
+	long	wall_ns;
+}			t_check;
+
+int			check_input(t_check *c);
+void		check_line(t_check *c, char *line, long len);
+void		violation(t_check *c, long id, char *what, long value);
+void		violation_id(t_check *c, char *what, long id);
+void		on_fork(t_check *c, long idx, long ts);
+void		on_eat(t_check *c, long idx, long ts);
+void		on_sleep(t_check *c, long idx, long ts);
+void		on_think(t_check *c, long idx, long ts);
+void		on_died(t_check *c, long idx, long ts);
+void		release_done(t_check *c, long idx, long ts);
+void		check_ring(t_check *c, long idx, long ts, int eating);
+void		check_pool(t_check *c, long ts);
+void		check_report(t_check *c);
+
+#endif
@@ -0,0 +1,48 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   philo_top.h                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:32:44 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 19:32:44 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PHILO_TOP_H
+# define PHILO_TOP_H
+
+# include <dirent.h>
+# include <errno.h>
+# include <fcntl.h>
+# include <signal.h>
+# include <stdio.h>
+# include <stdlib.h>
+# include <string.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <sys/time.h>
+# include <unistd.h>
+# include "metrics.h"
+
+# define SHM_DIR "/dev/shm"
+# define SHM_PREFIX "philo."
+# define SHM_PREFIX_LEN 6
+# define TOP_REFRESH_US 200000
+# define TOP_BAR 20
+
+typedef struct s_view
+{
+	t_mpage	*page;
+	size_t	size;
+	char	name[METRICS_NAME_MAX];
+	int		once;
+}			t_view;
+
+int			find_page(t_view *view, char *pid);
+int			attach_page(t_view *view);
+void		render(t_view *view, char *status);
+long		now_ms(void);
+
+#endif
@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   check_events.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 20:19:58 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 20:19:58 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_check.h"
+
+void	on_fork(t_check *c, long idx, long ts)
+{
+	t_seat	*s;
+
+	s = &c->seats[idx];
+	s->held++;
+	c->held++;
+	if (s->held > 2 || s->held > c->num)
+		violation(c, idx + 1, "holds more forks than it can reach", -1);
+	check_pool(c, ts);
+	if (!c->pool)
+		check_ring(c, idx, ts, 0);
+}
+
+void	on_eat(t_check *c, long idx, long ts)
+{
+	t_seat	*s;
+	long	gap;
+
+	s = &c->seats[idx];
+	if (c->num > 1 && s->held != 2)
+		violation(c, idx + 1, "eats without holding two forks", -1);
+	if (!c->pool)
+		check_ring(c, idx, ts, 1);
+	gap = ts - s->last_meal;
+	if (gap > s->max_gap)
+		s->max_gap = gap;
+	if (gap > c->t_die + c->tolerance)
+		violation(c, idx + 1, "starved past time_to_die without a death",
+			gap);
+	s->eat_ts = ts;
+	s->eating = 1;
+	s->last_meal = ts;
+	s->meals++;
+	c->meals++;
+}
+
+void	on_sleep(t_check *c, long idx, long ts)
+{
+	t_seat	*s;
+
+	s = &c->seats[idx];
+	if (s->eat_ts < 0)
+		violation(c, idx + 1, "sleeps without eating first", -1);
+	else if (ts - s->eat_ts < c->t_eat)
+		violation(c, idx + 1, "ate for less than time_to_eat",
+			ts - s->eat_ts);
+	c->held -= s->held;
+	s->held = 0;
+	s->eating = 0;
+	s->eat_ts = -1;
+	s->sleep_ts = ts;
+}
+
+void	on_think(t_check *c, long idx, long ts)
+{
+	t_seat	*s;
+
+	s = &c->seats[idx];
+	if (s->sleep_ts >= 0 && ts - s->sleep_ts < c->t_sleep)
+		violation(c, idx + 1, "slept for less than time_to_sleep",
+			ts - s->sleep_ts);
+	s->sleep_ts = -1;
+}
+
+void	on_died(t_check *c, long idx, long ts)
+{
+	long	late;
+
+	c->died_id = idx + 1;
+	c->died_ts = ts;
+	late = ts - (c->seats[idx].last_meal + c->t_die);
+	if (late < -c->tolerance)
+		violation(c, idx + 1, "died before time_to_die ran out", -late);
+	else if (late > c->tolerance)
+		violation(c, idx + 1, "death reported late", late);
+}
@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   check_input.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 20:19:58 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 20:19:58 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_check.h"
+
+static long	now_ns(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000000000L + ts.tv_nsec);
+}
+
+static long	feed_lines(t_check *c, char *buf, long len, int last)
+{
+	char	*nl;
+	long	pos;
+
+	pos = 0;
+	while (pos < len)
+	{
+		nl = memchr(buf + pos, '\n', len - pos);
+		if (!nl)
+			break ;
+		check_line(c, buf + pos, nl - (buf + pos));
+		pos = nl - buf + 1;
+	}
+	if (pos < len && (last || (pos == 0 && len == CHECK_CHUNK)))
+	{
+		check_line(c, buf + pos, len - pos);
+		pos = len;
+	}
+	c->bytes += pos;
+	return (pos);
+}
+
+static int	check_mapped(t_check *c, int fd, long size)
+{
+	char	*map;
+
+	map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (map == MAP_FAILED)
+		return (0);
+	madvise(map, size, MADV_SEQUENTIAL);
+	feed_lines(c, map, size, 1);
+	munmap(map, size);
+	return (1);
+}
+
+static int	check_stream(t_check *c, int fd)
+{
+	char	*buf;
+	long	kept;
+	long	got;
+	long	done;
+
+	buf = malloc(CHECK_CHUNK);
+	if (!buf)
+		return (0);
+	kept = 0;
+	got = 1;
+	while (got > 0)
+	{
+		got = read(fd, buf + kept, CHECK_CHUNK - kept);
+		if (got > 0)
+			kept += got;
+		done = feed_lines(c, buf, kept, got <= 0);
+		memmove(buf, buf + done, kept - done);
+		kept -= done;
+	}
+	free(buf);
+	return (got == 0);
+}
+
+int	check_input(t_check *c)
+{
+	struct stat	st;
+	long		start;
+	int			fd;
+	int			ok;
+
+	fd = STDIN_FILENO;
+	if (c->path)
+		fd = open(c->path, O_RDONLY);
+	if (fd < 0 || fstat(fd, &st) != 0)
+		return (0);
+	start = now_ns();
+	if (S_ISREG(st.st_mode) && st.st_size > 0)
+		ok = check_mapped(c, fd, st.st_size);
+	else
+		ok = check_stream(c, fd);
+	c->wall_ns = now_ns() - start;
+	if (c->path)
+		close(fd);
+	return (ok);
+}
@@ -0,0 +1,89 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   check_line.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 20:19:58 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 20:19:58 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_check.h"
+
+static char	*parse_field(char *p, char *end, long *dst)
+{
+	char	*start;
+
+	start = p;
+	*dst = 0;
+	while (p < end && *p >= '0' && *p <= '9')
+	{
+		if (*dst > (LONG_MAX - (*p - '0')) / 10)
+			return (NULL);
+		*dst = *dst * 10 + (*p++ - '0');
+	}
+	if (p == start || p >= end || *p != ' ')
+		return (NULL);
+	return (p + 1);
+}
+
+static int	event_kind(char *msg, long len)
+{
+	static char	*names[] = {"has taken a fork", "is eating", "is sleeping",
+		"is thinking", "died", NULL};
+	static long	lens[] = {16, 9, 11, 11, 4};
+	int			kind;
+
+	kind = 0;
+	while (names[kind])
+	{
+		if (lens[kind] == len && memcmp(names[kind], msg, len) == 0)
+			return (kind);
+		kind++;
+	}
+	return (-1);
+}
+
+static void	dispatch(t_check *c, long id, long ts, int kind)
+{
+	static void	(*handlers[])(t_check *, long, long) = {on_fork, on_eat,
+		on_sleep, on_think, on_died};
+
+	if (c->died_id >= 0)
+	{
+		violation(c, id, "event after a death", -1);
+		return ;
+	}
+	if (ts < c->last_ts)
+		violation(c, id, "timestamp went backwards", c->last_ts - ts);
+	else
+		c->last_ts = ts;
+	if (id < 1 || id > c->num)
+		violation_id(c, "no such philosopher", id);
+	else
+		handlers[kind](c, id - 1, ts);
+}
+
+void	check_line(t_check *c, char *line, long len)
+{
+	char	*end;
+	char	*msg;
+	long	ts;
+	long	id;
+	int		kind;
+
+	c->lines++;
+	end = line + len;
+	msg = parse_field(line, end, &ts);
+	if (msg)
+		msg = parse_field(msg, end, &id);
+	kind = -1;
+	if (msg)
+		kind = event_kind(msg, end - msg);
+	if (kind < 0)
+		violation(c, 0, "unrecognised line", -1);
+	else
+		dispatch(c, id, ts, kind);
+}
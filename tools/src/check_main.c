@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   check_main.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 20:19:58 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 20:19:58 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_check.h"
+
+static int	usage(void)
+{
+	fprintf(stderr, "Usage: ./philo-check [OPTIONS] number_of_philosophers "
+		"time_to_die time_to_eat\n"
+		"                     time_to_sleep [must_eat]\n\n"
+		"  Validates the output of a philo or philo_bonus run with the same\n"
+		"  arguments, read from stdin or --file, and prints a summary.\n\n"
+		"  --file=PATH       read PATH (mapped when it is a regular file)\n"
+		"  --pool            forks form one pool (philo_bonus), not a ring\n"
+		"  --tolerance=MS    allowed death report delay (%d)\n",
+		CHECK_TOLERANCE);
+	return (2);
+}
+
+static int	parse_num(char *s, long *dst)
+{
+	char	*end;
+
+	*dst = strtol(s, &end, 10);
+	return (end != s && *end == '\0' && *dst >= 0);
+}
+
+static int	parse_args(t_check *c, int ac, char **av)
+{
+	long	*fields[5];
+	int		idx;
+	int		pos;
+	int		ok;
+
+	fields[0] = &c->num;
+	fields[1] = &c->t_die;
+	fields[2] = &c->t_eat;
+	fields[3] = &c->t_sleep;
+	fields[4] = &c->must_eat;
+	pos = 0;
+	ok = 1;
+	idx = 0;
+	while (ok && ++idx < ac)
+	{
+		if (strcmp(av[idx], "--pool") == 0)
+			c->pool = 1;
+		else if (strncmp(av[idx], "--file=", 7) == 0)
+			c->path = av[idx] + 7;
+		else if (strncmp(av[idx], "--tolerance=", 12) == 0)
+			ok = parse_num(av[idx] + 12, &c->tolerance);
+		else
+			ok = (pos < 5 && parse_num(av[idx], fields[pos++]));
+	}
+	return (ok && pos >= 4 && c->num > 0);
+}
+
+static int	init_seats(t_check *c)
+{
+	long	idx;
+
+	c->seats = malloc(sizeof(t_seat) * c->num);
+	if (!c->seats)
+		return (0);
+	memset(c->seats, 0, sizeof(t_seat) * c->num);
+	idx = 0;
+	while (idx < c->num)
+	{
+		c->seats[idx].eat_ts = -1;
+		c->seats[idx].sleep_ts = -1;
+		idx++;
+	}
+	return (1);
+}
+
+int	main(int ac, char **av)
+{
+	t_check	c;
+
+	memset(&c, 0, sizeof(c));
+	c.must_eat = -1;
+	c.tolerance = CHECK_TOLERANCE;
+	c.died_id = -1;
+	if (!parse_args(&c, ac, av))
+		return (usage());
+	if (!init_seats(&c))
+		return (2);
+	if (!check_input(&c))
+	{
+		perror("philo-check");
+		free(c.seats);
+		return (2);
+	}
+	check_report(&c);
+	free(c.seats);
+	return (c.violations > 0);
+}
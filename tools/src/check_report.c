@@ -0,0 +1,115 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   check_report.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 20:19:58 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 20:19:58 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_check.h"
+
+static void	check_meals(t_check *c)
+{
+	long	idx;
+
+	if (c->died_id >= 0 || c->must_eat <= 0)
+		return ;
+	idx = 0;
+	while (idx < c->num)
+	{
+		if (c->seats[idx].meals < c->must_eat)
+			violation(c, idx + 1, "ended with too few meals",
+				c->seats[idx].meals);
+		idx++;
+	}
+}
+
+static void	print_throughput(t_check *c)
+{
+	double	secs;
+
+	secs = c->wall_ns / 1e9;
+	if (secs <= 0)
+		secs = 1e-9;
+	printf("input       %ld lines, %.1f MB in %.3f s (%.0f MB/s, "
+		"%.1f M lines/s)\n", c->lines, c->bytes / 1e6, secs,
+		c->bytes / 1e6 / secs, c->lines / 1e6 / secs);
+	printf("simulated   %ld ms, %ld meals", c->last_ts, c->meals);
+	if (c->last_ts > 0)
+		printf(", %.1f meals/s", c->meals * 1000.0 / c->last_ts);
+	printf("\n");
+}
+
+static void	print_meals(t_check *c)
+{
+	long	lo;
+	long	hi;
+	long	idx;
+
+	lo = 0;
+	hi = 0;
+	idx = 0;
+	while (++idx < c->num)
+	{
+		if (c->seats[idx].meals < c->seats[lo].meals)
+			lo = idx;
+		if (c->seats[idx].meals > c->seats[hi].meals)
+			hi = idx;
+	}
+	printf("meals       min %ld (id %ld), max %ld (id %ld), mean %.1f\n",
+		c->seats[lo].meals, lo + 1, c->seats[hi].meals, hi + 1,
+		(double)c->meals / c->num);
+}
+
+static void	print_starvation(t_check *c)
+{
+	long	worst;
+	long	gap;
+	long	idx;
+
+	worst = 0;
+	idx = 0;
+	while (idx < c->num)
+	{
+		gap = c->seats[idx].max_gap;
+		if (c->last_ts - c->seats[idx].last_meal > gap)
+			gap = c->last_ts - c->seats[idx].last_meal;
+		if (gap > c->seats[worst].max_gap)
+			worst = idx;
+		if (gap > c->seats[worst].max_gap)
+			c->seats[worst].max_gap = gap;
+		idx++;
+	}
+	printf("starvation  longest wait for a meal %ld ms (id %ld), "
+		"slack %ld ms\n", c->seats[worst].max_gap, worst + 1,
+		c->t_die - c->seats[worst].max_gap);
+}
+
+void	check_report(t_check *c)
+{
+	char	*forks;
+
+	check_meals(c);
+	forks = "ring";
+	if (c->pool)
+		forks = "pool";
+	printf("philo-check: %ld philosophers, die %ld eat %ld sleep %ld, "
+		"%s forks\n", c->num, c->t_die, c->t_eat, c->t_sleep, forks);
+	print_throughput(c);
+	print_meals(c);
+	print_starvation(c);
+	if (c->died_id < 0)
+		printf("death       none\n");
+	else
+		printf("death       id %ld at %ld ms, %ld ms after its deadline\n",
+			c->died_id, c->died_ts, c->died_ts
+			- c->seats[c->died_id - 1].last_meal - c->t_die);
+	if (c->violations)
+		printf("result      %ld violation(s)\n", c->violations);
+	else
+		printf("result      OK\n");
+}
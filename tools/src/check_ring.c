@@ -0,0 +1,62 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   check_ring.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 20:19:58 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 20:19:58 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_check.h"
+
+void	release_done(t_check *c, long idx, long ts)
+{
+	t_seat	*s;
+
+	s = &c->seats[idx];
+	if (s->eating && ts >= s->eat_ts + c->t_eat)
+	{
+		c->held -= s->held;
+		s->held = 0;
+		s->eating = 0;
+	}
+}
+
+void	check_pool(t_check *c, long ts)
+{
+	long	idx;
+
+	if (c->held <= c->num)
+		return ;
+	idx = 0;
+	while (idx < c->num)
+		release_done(c, idx++, ts);
+	if (c->held > c->num)
+		violation(c, 0, "more forks taken than exist", -1);
+}
+
+void	check_ring(t_check *c, long idx, long ts, int eating)
+{
+	long	next[2];
+	t_seat	*other;
+	int		side;
+
+	if (c->num < 3)
+		return ;
+	next[0] = (idx + c->num - 1) % c->num;
+	next[1] = (idx + 1) % c->num;
+	side = 0;
+	while (side < 2)
+	{
+		release_done(c, next[side], ts);
+		other = &c->seats[next[side]];
+		if (eating && other->eating)
+			violation(c, idx + 1, "eats while a neighbour is eating", -1);
+		else if (!eating && c->seats[idx].held + other->held > 3)
+			violation(c, idx + 1, "takes a fork its neighbour holds", -1);
+		side++;
+	}
+}
@@ -0,0 +1,44 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   check_violation.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 21:40:13 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 21:40:13 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_check.h"
+
+static int	count_violation(t_check *c)
+{
+	c->violations++;
+	if (c->violations > CHECK_SHOWN)
+	{
+		if (c->violations == CHECK_SHOWN + 1)
+			fprintf(stderr, "further violations not shown\n");
+		return (0);
+	}
+	fprintf(stderr, "line %ld: ", c->lines);
+	return (1);
+}
+
+void	violation(t_check *c, long id, char *what, long value)
+{
+	if (!count_violation(c))
+		return ;
+	if (id > 0)
+		fprintf(stderr, "philosopher %ld: ", id);
+	if (value >= 0)
+		fprintf(stderr, "%s (%ld ms)\n", what, value);
+	else
+		fprintf(stderr, "%s\n", what);
+}
+
+void	violation_id(t_check *c, char *what, long id)
+{
+	if (count_violation(c))
+		fprintf(stderr, "%s (id %ld)\n", what, id);
+}
@@ -0,0 +1,46 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   top_attach.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:32:44 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 19:32:44 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_top.h"
+
+static int	valid_page(t_mpage *page, size_t size)
+{
+	if (page->magic != METRICS_MAGIC || page->version != METRICS_VERSION)
+		return (0);
+	if (page->slot_size != (int) sizeof(t_mslot) || page->num < 1)
+		return (0);
+	return (size >= sizeof(t_mpage) + sizeof(t_mslot) * page->num);
+}
+
+int	attach_page(t_view *view)
+{
+	struct stat	st;
+	int			fd;
+	void		*page;
+
+	fd = shm_open(view->name, O_RDONLY, 0);
+	if (fd < 0)
+		return (0);
+	page = MAP_FAILED;
+	if (fstat(fd, &st) == 0 && (size_t) st.st_size >= sizeof(t_mpage))
+		page = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (page == MAP_FAILED)
+		return (0);
+	view->page = page;
+	view->size = st.st_size;
+	if (valid_page(view->page, view->size))
+		return (1);
+	munmap(view->page, view->size);
+	view->page = NULL;
+	return (0);
+}
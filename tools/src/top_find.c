@@ -0,0 +1,67 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   top_find.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:33:43 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 19:33:43 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_top.h"
+
+static int	is_digits(char *s)
+{
+	if (!*s)
+		return (0);
+	while (*s >= '0' && *s <= '9')
+		s++;
+	return (*s == '\0');
+}
+
+static int	is_page(char *name)
+{
+	return (strncmp(name, SHM_PREFIX, SHM_PREFIX_LEN) == 0
+		&& is_digits(name + SHM_PREFIX_LEN)
+		&& strlen(name) < METRICS_NAME_MAX - 1);
+}
+
+static int	find_newest(t_view *view)
+{
+	DIR				*dir;
+	struct dirent	*ent;
+	struct stat		st;
+	long			best;
+
+	dir = opendir(SHM_DIR);
+	if (!dir)
+		return (0);
+	best = -1;
+	ent = readdir(dir);
+	while (ent)
+	{
+		if (is_page(ent->d_name)
+			&& fstatat(dirfd(dir), ent->d_name, &st, 0) == 0
+			&& st.st_mtim.tv_sec * 1000000000L + st.st_mtim.tv_nsec >= best)
+		{
+			best = st.st_mtim.tv_sec * 1000000000L + st.st_mtim.tv_nsec;
+			view->name[0] = '/';
+			memcpy(view->name + 1, ent->d_name, strlen(ent->d_name) + 1);
+		}
+		ent = readdir(dir);
+	}
+	closedir(dir);
+	return (best >= 0);
+}
+
+int	find_page(t_view *view, char *pid)
+{
+	if (!pid)
+		return (find_newest(view));
+	if (!is_digits(pid) || strlen(pid) > 10)
+		return (0);
+	snprintf(view->name, METRICS_NAME_MAX, "%s%s", METRICS_PREFIX, pid);
+	return (1);
+}
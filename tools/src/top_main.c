@@ -0,0 +1,88 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   top_main.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:33:09 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 19:33:09 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_top.h"
+
+static int	usage(void)
+{
+	fprintf(stderr, "Usage: ./philo-top [--once] [PID]\n\n"
+		"  Attaches to the metrics page published by philo or philo_bonus\n"
+		"  run with --metrics. Without PID the newest page is used.\n");
+	return (1);
+}
+
+static int	parse_args(t_view *view, int ac, char **av, char **pid)
+{
+	int	idx;
+
+	idx = 1;
+	while (idx < ac)
+	{
+		if (strcmp(av[idx], "--once") == 0)
+			view->once = 1;
+		else if (!*pid && av[idx][0] != '-')
+			*pid = av[idx];
+		else
+			return (0);
+		idx++;
+	}
+	return (1);
+}
+
+static int	alive(t_mpage *page)
+{
+	return (kill(page->pid, 0) == 0 || errno == EPERM);
+}
+
+static int	watch(t_view *view)
+{
+	while (!atomic_load(&view->page->done) && alive(view->page))
+	{
+		render(view, "running");
+		if (view->once)
+			return (0);
+		usleep(TOP_REFRESH_US);
+	}
+	if (atomic_load(&view->page->done))
+	{
+		render(view, "finished");
+		return (0);
+	}
+	render(view, "stale: process gone, page removed");
+	shm_unlink(view->name);
+	return (1);
+}
+
+int	main(int ac, char **av)
+{
+	t_view	view;
+	char	*pid;
+	int		status;
+
+	memset(&view, 0, sizeof(view));
+	pid = NULL;
+	if (!parse_args(&view, ac, av, &pid))
+		return (usage());
+	if (!find_page(&view, pid))
+	{
+		fprintf(stderr, "Error: no metrics page found in %s\n", SHM_DIR);
+		return (1);
+	}
+	if (!attach_page(&view))
+	{
+		fprintf(stderr, "Error: cannot attach %s\n", view.name);
+		return (1);
+	}
+	status = watch(&view);
+	munmap(view.page, view.size);
+	return (status);
+}
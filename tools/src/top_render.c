@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   top_render.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: eabdelfa <eabdelfa@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:32:57 by eabdelfa          #+#    #+#             */
+/*   Updated: 2026/10/18 19:32:57 by eabdelfa         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_top.h"
+
+long	now_ms(void)
+{
+	struct timeval	tv;
+
+	gettimeofday(&tv, NULL);
+	return (tv.tv_sec * 1000 + tv.tv_usec / 1000);
+}
+
+static char	*state_name(int state)
+{
+	static char	*names[] = {"idle", "fork", "eating", "sleeping",
+		"thinking", "dead"};
+
+	if (state < ST_IDLE || state > ST_DEAD)
+		return ("?");
+	return (names[state]);
+}
+
+static void	render_bar(long left, long t_die)
+{
+	char	bar[TOP_BAR + 1];
+	long	fill;
+	int		idx;
+
+	fill = 0;
+	if (left > 0 && t_die > 0)
+		fill = (left * TOP_BAR + t_die - 1) / t_die;
+	if (fill > TOP_BAR)
+		fill = TOP_BAR;
+	idx = 0;
+	while (idx < TOP_BAR)
+	{
+		bar[idx] = '.';
+		if (idx < fill)
+			bar[idx] = '#';
+		idx++;
+	}
+	bar[TOP_BAR] = '\0';
+	printf("  %s\n", bar);
+}
+
+static void	render_row(t_mpage *page, int idx, long now)
+{
+	t_mslot	*slot;
+	long	last_meal;
+	long	left;
+	int		state;
+
+	slot = &page->slots[idx];
+	state = atomic_load_explicit(&slot->state, memory_order_acquire);
+	last_meal = atomic_load_explicit(&slot->last_meal, memory_order_relaxed);
+	left = atomic_load_explicit(&slot->deadline, memory_order_relaxed) - now;
+	if (last_meal == 0)
+	{
+		last_meal = now;
+		left = page->t_die;
+	}
+	if (state == ST_DEAD)
+		left = 0;
+	printf("%5d  %-9s %6d %9ld %9ld", idx + 1, state_name(state),
+		atomic_load_explicit(&slot->meals, memory_order_relaxed),
+		now - last_meal, left);
+	render_bar(left, page->t_die);
+}
+
+void	render(t_view *view, char *status)
+{
+	t_mpage	*page;
+	long	now;
+	long	start;
+	int		idx;
+
+	page = view->page;
+	now = now_ms();
+	start = atomic_load(&page->start);
+	if (!view->once)
+		printf("\033[H\033[2J");
+	printf("philo-top  %s  pid %d  %s\n", view->name, page->pid, status);
+	printf("N %d  die %ld  eat %ld  sleep %ld  must %ld  elapsed %ld ms\n\n",
+		page->num, page->t_die, page->t_eat, page->t_sleep, page->must_eat,
+		(now - start) * (start > 0));
+	printf("%5s  %-9s %6s %9s %9s  %s\n", "ID", "STATE", "MEALS",
+		"SINCE(ms)", "LEFT(ms)", "DEADLINE");
+	idx = 0;
+	while (idx < page->num)
+	{
+		render_row(page, idx, now);
+		idx++;
+	}
+	fflush(stdout);
+}